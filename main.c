@@ -9,11 +9,25 @@
 
 // NESTED INCLUDES
 
+#ifndef _GNU_SOURCE
+    #define _GNU_SOURCE
+#endif
+
 #include <stdio.h>
 #include <stdint.h>
 #include <stdbool.h>
 #include <stdlib.h>
 #include <string.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <sys/wait.h>
+#include <pthread.h>
+#include <time.h>
+
+#include "mem_export.h"
 
 #define     M68K_MAX_BUFFERS          5
 
@@ -36,6 +50,7 @@
 static unsigned int M68K_T0 = 0;
 static unsigned int M68K_T1 = 1;
 static unsigned int M68K_STOPPED;
+static unsigned int M68K_PC = 0;
 
 #define         M68K_T0_SHIFT                   (1 << 3)
 #define         M68K_T1_SHIFT                   (1 << 4)
@@ -59,12 +74,140 @@ static unsigned int M68K_STOPPED;
 #define         M68K_BUS_ALIGNMENT(ADDRESS, SIZE) \
                 (((SIZE) == MEM_SIZE_8) ? true : !((ADDRESS) & 1))
 
+// THE BUFFERS ARE STORED IN THE 68K'S NATIVE BIG ENDIAN ORDER, SO ANY ACCESS
+// WIDER THAN A BYTE THROUGH A HOST POINTER NEEDS TO BE SWAPPED ON LITTLE ENDIAN HOSTS
+
+#if defined(__BYTE_ORDER__) && (__BYTE_ORDER__ == __ORDER_BIG_ENDIAN__)
+    #define     M68K_BE_16(VALUE)           ((uint16_t)(VALUE))
+    #define     M68K_BE_32(VALUE)           ((uint32_t)(VALUE))
+#else
+    #define     M68K_BE_16(VALUE)           __builtin_bswap16((uint16_t)(VALUE))
+    #define     M68K_BE_32(VALUE)           __builtin_bswap32((uint32_t)(VALUE))
+#endif
+
+// EACH REGION IS FINGERPRINTED AS A TREE OF PAGE HASHES, ONLY THE PAGES
+// WRITTEN SINCE THE LAST QUERY BEING REHASHED
+
+#define         M68K_HASH_PAGE_SHIFT            12
+#define         M68K_HASH_PAGE_SIZE             (1 << M68K_HASH_PAGE_SHIFT)
+
+// MEMORY MAP FLAGS - PASSED THROUGH MEMORY_MAP_EX TO DETERMINE
+// HOW THE BACKING BUFFER FOR A REGION IS ACCESSED
+
+#define         M68K_MAP_NONE                   0
+#define         M68K_MAP_SHARED                 (1 << 0)
+#define         M68K_MAP_EXPORT                 (1 << 1)
+
+// BACKING POLICIES FOR LARGE REGIONS - HUGE PAGES TO CUT DOWN ON HOST TLB MISSES,
+// PREFAULTING FOR LATENCY SENSITIVE RAM AND PLACEMENT ON THE NUMA NODE OF THE MAPPING THREAD
+//
+// HUGETLB FALLS BACK ON THP, WHICH IN TURN FALLS BACK ON ORDINARY PAGES
+
+#define         M68K_MAP_THP                    (1 << 2)
+#define         M68K_MAP_HUGETLB                (1 << 3)
+#define         M68K_MAP_POPULATE               (1 << 4)
+#define         M68K_MAP_NUMA_LOCAL             (1 << 5)
+
+#define         M68K_MAP_BACKING                (M68K_MAP_THP | M68K_MAP_HUGETLB | M68K_MAP_POPULATE | M68K_MAP_NUMA_LOCAL)
+
+// WHAT THE BACKING OF A REGION ENDED UP BEING - AS OPPOSED TO WHAT WAS ASKED FOR
+
+#define         M68K_BACKING_HEAP               0
+#define         M68K_BACKING_ANON               (1 << 0)
+#define         M68K_BACKING_THP                (1 << 1)
+#define         M68K_BACKING_HUGETLB            (1 << 2)
+#define         M68K_BACKING_POPULATED          (1 << 3)
+#define         M68K_BACKING_NUMA               (1 << 4)
+#define         M68K_BACKING_SHM                (1 << 5)
+#define         M68K_BACKING_STATIC             (1 << 6)
+#define         M68K_BACKING_THP_ADVISED        (1 << 7)
+
+#define         M68K_PAGE_SIZE                  (4 * KB_TO_BYTES)
+#define         M68K_HUGE_PAGE_SIZE             (2 * MB_TO_BYTES)
+
+// THE FLAGS WHICH MEMORY_MAP APPLIES TO EVERY REGION
+// (-DM68K_MAP_DEFAULT_FLAGS=M68K_MAP_EXPORT TO EXPORT EVERYTHING FOR INSTANCE)
+
+#ifndef         M68K_MAP_DEFAULT_FLAGS
+    #define     M68K_MAP_DEFAULT_FLAGS          M68K_MAP_NONE
+#endif
+
 // 02/02/26 - ADDING THIS HERE FOR DEBUGGING AFTER RECENT DISCOVERY
 
 #ifndef         FORCE_UNSAFE_REGIONS
     #define     FORCE_UNSAFE_REGIONS         M68K_OPT_OFF
 #endif
 
+// FOR MACHINE CONFIGURATIONS WHICH ARE FIXED AT BUILD TIME, THE MEMORY MAP CAN BE
+// DESCRIBED STATICALLY - THE DECODER AND BACKING STORAGE ARE THEN GENERATED BY THE COMPILER
+// AND THE M68K_READ/WRITE_MEMORY ENTRY POINTS ROUTE THROUGH IT WITHOUT WALKING MEM_BUFFERS
+//
+// OVERRIDE M68K_STATIC_MEMORY_MAP BEFORE INCLUDING OR ON THE COMMAND LINE TO DESCRIBE ANOTHER MACHINE
+
+#ifndef         STATIC_MAP_HOOK
+    #define     STATIC_MAP_HOOK              M68K_OPT_OFF
+#endif
+
+// EVERY FAULTING ACCESS IS RECORDED AS A STRUCTURED EVENT IN A BOUNDED QUEUE
+// WITH THE DEFERRED HOOK ON, MEM_ERROR NO LONGER FORMATS ANYTHING AT THE POINT OF THE FAULT
+// AND THE TEXT IS ONLY PRODUCED WHEN THE QUEUE IS SHOWN - KEEPING FAULT HEAVY RUNS AT FULL SPEED
+
+#ifndef         DEFERRED_ERROR_HOOK
+    #define     DEFERRED_ERROR_HOOK          M68K_OPT_OFF
+#endif
+
+// MUST BE A POWER OF TWO
+#ifndef         M68K_BERR_QUEUE_SIZE
+    #define     M68K_BERR_QUEUE_SIZE         1024
+#endif
+
+// OPT-IN LATENCY INSTRUMENTATION OF THE BUS ENTRY POINTS - ONE IN EVERY M68K_LATENCY_SAMPLE_RATE
+// ACCESSES IS TIMESTAMPED AND BINNED INTO A LOG BUCKETED HISTOGRAM BY REGION, PATH AND OUTCOME
+//
+// RDTSC IS USED WHERE AVAILABLE, CLOCK_GETTIME OTHERWISE (OR WITH -DM68K_LATENCY_RDTSC=0)
+
+#ifndef         LATENCY_HOOK
+    #define     LATENCY_HOOK                 M68K_OPT_OFF
+#endif
+
+#ifndef         M68K_LATENCY_SAMPLE_RATE
+    #define     M68K_LATENCY_SAMPLE_RATE     64
+#endif
+
+#ifndef         M68K_LATENCY_RDTSC
+    #if defined(__x86_64__) || defined(__i386__)
+        #define M68K_LATENCY_RDTSC           1
+    #else
+        #define M68K_LATENCY_RDTSC           0
+    #endif
+#endif
+
+#ifndef         M68K_LATENCY_JSON
+    #define     M68K_LATENCY_JSON            "mem_latency.json"
+#endif
+
+#define         M68K_LATENCY_BUCKETS            160
+
+// NAME, START, END, WRITEABLE, USES BUS ERROR, MAP FLAGS
+#ifndef         M68K_STATIC_MEMORY_MAP
+    #define     M68K_STATIC_MEMORY_MAP(REGION) \
+                REGION(RAM, 0x000000, 0xFFFFFF, true, true, M68K_MAP_NONE)
+#endif
+
+// RANDOMISED DIFFERENTIAL VALIDATION OF THE BUS (./mem --validate [SECONDS] [WORKERS] [SEED])
+// WITH THE STATIC MAP, EVERY STREAM IS RUN OVER IT'S LAYOUT RATHER THAN A RANDOM ONE
+
+#ifndef         VALIDATE_HOOK
+    #define     VALIDATE_HOOK                M68K_OPT_ON
+#endif
+
+#ifndef         M68K_VALIDATE_OPS
+    #define     M68K_VALIDATE_OPS            4096
+#endif
+
+#define         M68K_VALIDATE_MAX_REGION        0x10000
+#define         M68K_VALIDATE_MAX_MOVE          64
+
 /////////////////////////////////////////////////////
 //        BASE MEMORY VALIDATOR STRUCTURES
 /////////////////////////////////////////////////////
@@ -79,7 +222,8 @@ typedef enum
     MEM_UNMAP = 'U',
     MEM_MOVE = 'O',
     MEM_ERR = 'E',
-    MEM_BUS = 'B'
+    MEM_BUS = 'B',
+    MEM_RMW = 'L'
 
 } M68K_MEM_OP;
 
@@ -105,7 +249,10 @@ typedef enum
     MEM_ERR_BAD_READ,
     MEM_ERR_BAD_WRITE,
     MEM_ERR_BERR,
-    MEM_ERR_ALIGN
+    MEM_ERR_ALIGN,
+    MEM_ERR_EXPORT,
+    MEM_ERR_BACKING,
+    MEM_ERR_COUNT
 
 } M68K_MEM_ERROR;
 
@@ -118,6 +265,7 @@ typedef enum
     BERR_ALIGN,
     BERR_BOUNDS,
     BERR_TIMEOUT,
+    BERR_LINE_HELD,
     BERR_DOUBLE_FAULT
     
 } M68K_BERR_TYPE;
@@ -137,20 +285,20 @@ typedef struct
 
 } M68K_BERR_STATE;
 
+// M68K_MEM_USAGE IS DEFINED WITHIN MEM_EXPORT.H, AS EXPORTED REGIONS KEEP IT IN SHARED MEMORY
+// EACH BUFFER THEREFORE ONLY HOLDS A POINTER TO IT'S COUNTERS, WHEREVER THEY MAY LIVE
+
+// A BINARY HASH TREE OVER EVERY PAGE IN A REGION, STORED AS A HEAP
+// NODES[1] IS THE ROOT AND NODES[LEAVES + PAGE] IS THE HASH OF THAT PAGE
+
 typedef struct
 {
-    uint32_t READ_COUNT;
-    uint32_t WRITE_COUNT;
-    uint32_t MOVE_COUNT;
-    uint32_t LAST_READ;
-    uint32_t LAST_WRITE;
-    uint32_t LAST_MOVE_SRC;
-    uint32_t LAST_MOVE_DEST;
-    uint32_t VIOLATION;
-    uint32_t BUS_ERROR;
-    bool ACCESSED;
+    uint32_t PAGES;
+    uint32_t LEAVES;
+    uint64_t* NODES;
+    uint64_t* DIRTY;
 
-} M68K_MEM_USAGE;
+} M68K_MEM_HASH;
 
 typedef struct
 {
@@ -160,19 +308,205 @@ typedef struct
     uint8_t* BUFFER;
     bool WRITE;
     bool BERR;
-    M68K_MEM_USAGE USAGE;
+    uint32_t FLAGS;
+    uint32_t BACKING;
+    uint32_t BACKING_SIZE;
+    int NODE;
+    M68K_MEM_USAGE* USAGE;
+    M68K_MEM_HASH HASH;
 
 } M68K_MEM_BUFFER;
 
+// READ-MODIFY-WRITE OPERATIONS FOR THE LOCKED BUS CYCLE
+// THE VALUE RETURNED IS ALWAYS THE ONE PRESENT BEFORE THE OPERATION
+
+typedef enum
+{
+    MEM_RMW_ADD,
+    MEM_RMW_SUB,
+    MEM_RMW_AND,
+    MEM_RMW_OR,
+    MEM_RMW_XOR,
+    MEM_RMW_SWAP
+
+} M68K_MEM_RMW;
+
+typedef struct
+{
+    M68K_BERR_TYPE TYPE;
+    M68K_MEM_ERROR ERROR;
+    M68K_MEM_OP OP;
+    uint32_t ADDRESS;
+    uint32_t SIZE;
+    uint32_t PC;
+    bool DOUBLE_FAULT;
+
+} M68K_BERR_EVENT;
+
+// WHEN FULL, NEW EVENTS ARE DROPPED (AND COUNTED) SO THE ORIGINAL FAULT IS NEVER LOST
+// THE PER TYPE AND PER ERROR COUNTERS ARE ALWAYS MAINTAINED REGARDLESS
+//
+// EACH SLOT CARRIES A SEQUENCE NUMBER (STORED RELATIVE TO IT'S INDEX, SO THAT AN ALL ZERO QUEUE
+// IS AN EMPTY ONE) WHICH SAYS WHETHER IT IS FREE FOR THE NEXT PUSH OR HOLDS AN EVENT TO BE DRAINED
+
+typedef struct
+{
+    M68K_BERR_EVENT EVENT;
+    uint32_t SEQ;
+
+} M68K_BERR_SLOT;
+
+typedef struct
+{
+    M68K_BERR_SLOT SLOTS[M68K_BERR_QUEUE_SIZE];
+    uint32_t HEAD;
+    uint32_t TAIL;
+    uint32_t DROPPED;
+    uint32_t TYPE_COUNT[BERR_DOUBLE_FAULT + 1];
+    uint32_t ERROR_COUNT[MEM_ERR_COUNT];
+
+} M68K_BERR_QUEUE;
+
+#if LATENCY_HOOK == M68K_OPT_ON
+
+typedef enum
+{
+    MEM_LAT_READ,
+    MEM_LAT_WRITE,
+    MEM_LAT_MOVE,
+    MEM_LAT_RMW,
+    MEM_LAT_PATHS
+
+} M68K_MEM_LATENCY_PATH;
+
+typedef enum
+{
+    MEM_LAT_OK,
+    MEM_LAT_UNMAPPED,
+    MEM_LAT_READONLY,
+    MEM_LAT_ALIGN,
+    MEM_LAT_BOUNDS,
+    MEM_LAT_BERR,
+    MEM_LAT_OUTCOMES
+
+} M68K_MEM_LATENCY_OUTCOME;
+
+// FOUR BUCKETS PER POWER OF TWO - FINE ENOUGH FOR A P99 TO MEAN SOMETHING,
+// COARSE ENOUGH THAT A HISTOGRAM IS ONLY A FEW HUNDRED BYTES
+
+typedef struct
+{
+    uint64_t COUNT;
+    uint64_t TOTAL;
+    uint64_t MIN;
+    uint64_t MAX;
+    uint32_t BUCKETS[M68K_LATENCY_BUCKETS];
+
+} M68K_MEM_LATENCY;
+
+// THE SAMPLING STATE OF EACH THREAD ON THE BUS - WHICH ACCESS IS NEXT TO BE SAMPLED,
+// WHEN IT STARTED AND THE FIRST FAULT IT RAISED
+
+typedef struct
+{
+    uint32_t COUNTDOWN;
+    uint64_t START;
+    M68K_MEM_ERROR FAULT;
+
+} M68K_MEM_LATENCY_SAMPLE;
+
+// SHARED BY EVERY THREAD - THE RATE, AND THE POINT FROM WHICH TICKS ARE CALIBRATED TO NANOSECONDS
+
+typedef struct
+{
+    uint32_t RATE;
+    uint64_t ORIGIN_TICKS;
+    uint64_t ORIGIN_NS;
+
+} M68K_MEM_LATENCY_STATE;
+
+#endif
+
 /////////////////////////////////////////////////////
 //              GLOBAL DEFINITIONS
 /////////////////////////////////////////////////////
 
 static M68K_MEM_BUFFER MEM_BUFFERS[M68K_MAX_BUFFERS];
+static M68K_MEM_USAGE MEM_USAGE[M68K_MAX_BUFFERS];
 static unsigned MEM_NUM_BUFFERS = 0;
 static bool TRACE_ENABLED = true;
 static uint8_t ENABLED_FLAGS = M68K_OPT_FLAGS;
 static M68K_BERR_STATE BERR_STATE = {0};
+static uintptr_t BERR_OWNER = 0;
+static __thread char BERR_THREAD;
+static M68K_BERR_QUEUE BERR_QUEUE = {0};
+
+#if LATENCY_HOOK == M68K_OPT_ON
+
+// THE LAST ROW OF REGIONS BEING EVERY ACCESS WHICH DIDN'T DECODE TO ONE
+// TRACED AND UNTRACED ACCESSES ARE KEPT APART, SO THE COST OF THE TRACE OUTPUT ITSELF STANDS OUT
+
+static M68K_MEM_LATENCY MEM_LATENCY[M68K_MAX_BUFFERS + 1][MEM_LAT_PATHS][MEM_LAT_OUTCOMES][2];
+static M68K_MEM_LATENCY_STATE MEM_LATENCY_STATE = { M68K_LATENCY_SAMPLE_RATE, 0, 0 };
+static __thread M68K_MEM_LATENCY_SAMPLE MEM_LATENCY_SAMPLE = { M68K_LATENCY_SAMPLE_RATE, 0, MEM_OK };
+
+void SHOW_MEMORY_LATENCY(void);
+
+#endif
+
+#if STATIC_MAP_HOOK == M68K_OPT_ON
+
+// EACH ENTRY OF THE STATIC MAP EXPANDS INTO AN INDEX, IT'S OWN STATICALLY SIZED
+// BACKING STORAGE AND A BUFFER DESCRIPTOR IDENTICAL TO ONE CREATED BY MEMORY_MAP
+
+#define STATIC_REGION_INDEX(NAME, LOW, HIGH, RW, ERR, MAP)        STATIC_REGION_##NAME,
+#define STATIC_REGION_SIZE(NAME, LOW, HIGH, RW, ERR, MAP)         + ((HIGH) - (LOW) + 1)
+#define STATIC_REGION_NAME(NAME, LOW, HIGH, RW, ERR, MAP)         #NAME,
+
+#define STATIC_REGION_STORAGE(NAME, LOW, HIGH, RW, ERR, MAP) \
+    static uint8_t STATIC_BUFFER_##NAME[(HIGH) - (LOW) + 1] __attribute__((aligned(64)));
+
+#define STATIC_REGION_ENTRY(NAME, LOW, HIGH, RW, ERR, MAP) \
+    [STATIC_REGION_##NAME] = { .BASE = (LOW), .END = (HIGH), .SIZE = (HIGH) - (LOW) + 1, \
+        .BUFFER = STATIC_BUFFER_##NAME, .WRITE = (RW), .BERR = (ERR), .FLAGS = (MAP), \
+        .BACKING = M68K_BACKING_STATIC, .USAGE = &STATIC_USAGE[STATIC_REGION_##NAME] },
+
+// THE SAME CHECKS AS MEMORY_MAP, ONLY NOW THEY FAIL THE BUILD RATHER THAN THE MAP
+// (A NEGATIVE ARRAY SIZE BEING THE C99 EQUIVALENT OF A STATIC ASSERTION)
+//
+// STATIC STORAGE CAN ONLY BE SHARED - EXPORTING IT OR GIVING IT A BACKING POLICY NEEDS A MAPPING
+// OF IT'S OWN, SO ANY OTHER MAP FLAG FAILS THE BUILD RATHER THAN BEING SILENTLY IGNORED
+
+#define STATIC_REGION_CHECK(NAME, LOW, HIGH, RW, ERR, MAP) \
+    typedef char STATIC_CHECK_BUS_LIMIT_##NAME[((HIGH) >= (LOW) && (HIGH) <= M68K_MAX_ADDR_END) ? 1 : -1]; \
+    typedef char STATIC_CHECK_MAP_FLAGS_##NAME[(((MAP) & ~M68K_MAP_SHARED) == 0) ? 1 : -1];
+
+typedef enum
+{
+    M68K_STATIC_MEMORY_MAP(STATIC_REGION_INDEX)
+    STATIC_NUM_REGIONS
+
+} M68K_STATIC_REGION;
+
+M68K_STATIC_MEMORY_MAP(STATIC_REGION_CHECK)
+typedef char STATIC_CHECK_BUFFERS[(STATIC_NUM_REGIONS <= M68K_MAX_BUFFERS) ? 1 : -1];
+typedef char STATIC_CHECK_MAPPED_SIZE[((0 M68K_STATIC_MEMORY_MAP(STATIC_REGION_SIZE)) <= M68K_MAX_MEMORY_SIZE) ? 1 : -1];
+
+M68K_STATIC_MEMORY_MAP(STATIC_REGION_STORAGE)
+
+static M68K_MEM_USAGE STATIC_USAGE[STATIC_NUM_REGIONS];
+
+static M68K_MEM_BUFFER STATIC_BUFFERS[STATIC_NUM_REGIONS] = 
+{
+    M68K_STATIC_MEMORY_MAP(STATIC_REGION_ENTRY)
+};
+
+static const char* STATIC_REGION_NAMES[STATIC_NUM_REGIONS] = 
+{
+    M68K_STATIC_MEMORY_MAP(STATIC_REGION_NAME)
+};
+
+#endif
 
 static const char* M68K_MEM_ERR[] = 
 {
@@ -188,7 +522,9 @@ static const char* M68K_MEM_ERR[] =
     "MEMORY ENCOUNTERED A BAD READ",
     "MEMORY ENCOUNTERED A BAD WRITE",
     "BUS HAS THROWN AN ERROR EXCEPTION",
-    "BUS HAS AN ALIGNMENT ERROR"
+    "BUS HAS AN ALIGNMENT ERROR",
+    "MEMORY COULD NOT BE EXPORTED",
+    "MEMORY BACKING POLICY FAILED"
 };
 
 // SPECIFC ERROR HANDLERS FOR THE BUS ERRRO
@@ -201,6 +537,7 @@ static const char* M68K_BERR_ERR[] =
     "ALIGNMENT ERROR",
     "BOUNDS VIOLATION",
     "BUS TIMEOUT",
+    "BERR LINE HELD",
     "DOUBLE FAULT"
 };
 
@@ -223,32 +560,84 @@ bool IS_TRACE_ENABLED(uint8_t FLAG)
     return (ENABLED_FLAGS & FLAG) == FLAG;
 }
 
+static unsigned long MEM_THP_RESIDENT(const uint8_t* BASE);
+
+// THE BACKING ACTUALLY IN EFFECT FOR A REGION - THE PAGE SIZE IT ENDED UP WITH,
+// WHETHER IT WAS PREFAULTED AND WHICH NUMA NODE IT WAS PLACED ON
+//
+// HUGE PAGES WHICH WERE ONLY ADVISED ARE LOOKED FOR AGAIN, AS THEY MAY HAVE SINCE BEEN FAULTED IN
+// OR COLLAPSED BY KHUGEPAGED - "THP?" BEING A REQUEST WHICH NOTHING HAS HONOURED YET
+
+static const char* MEM_BACKING_NAME(const M68K_MEM_BUFFER* BUF, char* OUT, size_t LENGTH)
+{
+    bool THP = (BUF->BACKING & M68K_BACKING_THP) || 
+               ((BUF->BACKING & M68K_BACKING_THP_ADVISED) && MEM_THP_RESIDENT(BUF->BUFFER) > 0);
+
+    const char* PAGES = 
+        (BUF->BACKING & M68K_BACKING_SHM) ? "SHM" :
+        (BUF->BACKING & M68K_BACKING_STATIC) ? "STATIC" :
+        (BUF->BACKING & M68K_BACKING_HUGETLB) ? "2M" :
+        THP ? "THP" :
+        (BUF->BACKING & M68K_BACKING_THP_ADVISED) ? "THP?" :
+        (BUF->BACKING & M68K_BACKING_ANON) ? "4K" : "HEAP";
+
+    int WRITTEN = snprintf(OUT, LENGTH, "%s%s", PAGES, (BUF->BACKING & M68K_BACKING_POPULATED) ? "+PF" : "");
+
+    if((BUF->BACKING & M68K_BACKING_NUMA) && WRITTEN > 0 && (size_t)WRITTEN < LENGTH)
+        snprintf(OUT + WRITTEN, LENGTH - WRITTEN, " N%d", BUF->NODE);
+
+    return OUT;
+}
+
+static void SHOW_MEMORY_MAP_ROW(const M68K_MEM_BUFFER* BUF)
+{
+    char BACKING[24];
+
+    printf("0x%08X 0x%08X   %4d%s   %3s   %2s  %7u  %7u %6u      %3s     %4u        %6u   %s\n",
+            BUF->BASE,
+            BUF->BASE + BUF->SIZE - 1,
+            FORMAT_SIZE(BUF->SIZE), 
+            FORMAT_UNIT(BUF->SIZE),
+            BUF->BERR ? "ON" : "OFF",
+            BUF->WRITE ? "RW" : "RO",
+            BUF->USAGE->READ_COUNT,
+            BUF->USAGE->WRITE_COUNT,
+            BUF->USAGE->MOVE_COUNT,
+            BUF->USAGE->ACCESSED ? "YES" : "NO",
+            BUF->USAGE->VIOLATION,
+            BUF->USAGE->BUS_ERROR,
+            MEM_BACKING_NAME(BUF, BACKING, sizeof(BACKING)));
+}
+
 void SHOW_MEMORY_MAPS(void)
 {
     printf("\n%s MEMORY MAPS:\n", M68K_STOPPED ? "AFTER" : "BEFORE");
-    printf("------------------------------------------------------------------------------------------------------\n");
-    printf("START        END         SIZE    BERR  STATE   READS   WRITES  MOVES   ACCESS  VIOLATIONS   BUS_ERRORS\n");
-    printf("------------------------------------------------------------------------------------------------------\n");
+    printf("-------------------------------------------------------------------------------------------------------------------\n");
+    printf("START        END         SIZE    BERR  STATE   READS   WRITES  MOVES   ACCESS  VIOLATIONS   BUS_ERRORS   BACKING\n");
+    printf("-------------------------------------------------------------------------------------------------------------------\n");
 
     for (unsigned INDEX = 0; INDEX < MEM_NUM_BUFFERS; INDEX++)
     {
-        M68K_MEM_BUFFER* BUF = &MEM_BUFFERS[INDEX];
-        printf("0x%08X 0x%08X   %4d%s   %3s   %2s  %7u  %7u %6u      %3s     %4u        %6u\n",
-                BUF->BASE,
-                BUF->BASE + BUF->SIZE - 1,
-                FORMAT_SIZE(BUF->SIZE), 
-                FORMAT_UNIT(BUF->SIZE),
-                BUF->BERR ? "ON" : "OFF",
-                BUF->WRITE ? "RW" : "RO",
-                BUF->USAGE.READ_COUNT,
-                BUF->USAGE.WRITE_COUNT,
-                BUF->USAGE.MOVE_COUNT,
-                BUF->USAGE.ACCESSED ? "YES" : "NO",
-                BUF->USAGE.VIOLATION,
-                BUF->USAGE.BUS_ERROR);
+        SHOW_MEMORY_MAP_ROW(&MEM_BUFFERS[INDEX]);
     }
 
-    printf("------------------------------------------------------------------------------------------------------\n");
+    printf("-------------------------------------------------------------------------------------------------------------------\n");
+
+#if STATIC_MAP_HOOK == M68K_OPT_ON
+    printf("STATIC MEMORY MAP:\n");
+    printf("-------------------------------------------------------------------------------------------------------------------\n");
+
+    for (unsigned INDEX = 0; INDEX < STATIC_NUM_REGIONS; INDEX++)
+    {
+        SHOW_MEMORY_MAP_ROW(&STATIC_BUFFERS[INDEX]);
+    }
+
+    printf("-------------------------------------------------------------------------------------------------------------------\n");
+#endif
+
+#if LATENCY_HOOK == M68K_OPT_ON
+    SHOW_MEMORY_LATENCY();
+#endif
 }
 
 /////////////////////////////////////////////////////
@@ -314,6 +703,15 @@ void SHOW_MEMORY_MAPS(void)
                 (int)(SIZE), ##__VA_ARGS__); \
     } while(0)
 
+// THE ERRORS OF A FAULTING ACCESS, EACH OF WHICH IS ALREADY RECORDED IN THE BERR QUEUE
+// ONLY THESE ARE COMPILED OUT WHEN DEFERRED - CONFIGURATION ERRORS ARE ALWAYS REPORTED
+
+#if DEFERRED_ERROR_HOOK == M68K_OPT_OFF
+    #define MEM_FAULT_ERROR(ERROR_CODE, SIZE, MSG, ...)     MEM_ERROR(ERROR_CODE, SIZE, MSG, ##__VA_ARGS__)
+#else
+    #define MEM_FAULT_ERROR(ERROR_CODE, SIZE, MSG, ...)     ((void)0)
+#endif
+
 #define VERBOSE_TRACE(MSG, ...) \
     do { \
         if (VERBOSE_TRACE_HOOK == M68K_OPT_ON && IS_TRACE_ENABLED(M68K_OPT_VERB) && CHECK_TRACE_CONDITION()) \
@@ -349,441 +747,3171 @@ void SHOW_MEMORY_MAPS(void)
     printf("\n")
 
 /////////////////////////////////////////////////////
-//             MEMORY READ AND WRITE
+//              SHARED REGION ACCESS
 /////////////////////////////////////////////////////
 
-static M68K_MEM_BUFFER* MEM_FIND(uint32_t ADDRESS)
+// REGIONS MAPPED WITH M68K_MAP_SHARED CAN BE ACCESSED CONCURRENTLY BY A DEVICE THREAD
+// (Z80, DSP, ETC) RUNNING ON ANOTHER CORE - EVERY PLAIN ACCESS AND USAGE COUNTER THEREFORE
+// GOES THROUGH A RELAXED ATOMIC SO THAT NEITHER SIDE EVER DATA RACES THE OTHER
+//
+// THE BUS ERROR STATE ITSELF REMAINS OWNED BY THE 68K SIDE, ONLY THE LINE IS SAMPLED ATOMICALLY
+
+#define MEM_USAGE_INC(BUF, FIELD) \
+    do { \
+        if((BUF)->FLAGS & M68K_MAP_SHARED) \
+            __atomic_fetch_add(&(BUF)->USAGE->FIELD, 1, __ATOMIC_RELAXED); \
+        else \
+            (BUF)->USAGE->FIELD++; \
+    } while(0)
+
+#define MEM_USAGE_SET(BUF, FIELD, VAL) \
+    do { \
+        if((BUF)->FLAGS & M68K_MAP_SHARED) \
+            __atomic_store_n(&(BUF)->USAGE->FIELD, (VAL), __ATOMIC_RELAXED); \
+        else \
+            (BUF)->USAGE->FIELD = (VAL); \
+    } while(0)
+
+#define         BERR_LINE_ACTIVE()              __atomic_load_n(&BERR_STATE.ACTIVE, __ATOMIC_RELAXED)
+
+// THE 68000 ONLY HAS A 16 BIT DATA BUS, SO A LONG WORD IS TWO SEPARATE BUS CYCLES ANYWAY
+// WHICH MEANS SPLITTING A LONG THAT ISN'T HOST ALIGNED INTO TWO WORDS IS FAITHFUL TO THE HARDWARE
+
+static uint32_t MEM_LOAD_SHARED(uint8_t* MEM_PTR, uint32_t SIZE)
 {
-    VERBOSE_TRACE("FOUND MEMORY: 0x%04X", ADDRESS);
+    uintptr_t HOST = (uintptr_t)MEM_PTR;
 
-    // ITERATE THROUGH ALL REGISTERED MEMORY BUFFERS
-    for(unsigned INDEX = 0; INDEX < MEM_NUM_BUFFERS; INDEX++)
+    switch (SIZE)
     {
-        // GET A POINTER TO THE CURRENT MEMORY BUFFER
-        M68K_MEM_BUFFER* MEM_BASE = MEM_BUFFERS + INDEX;
+        case MEM_SIZE_32:
+            if(!(HOST & 3))
+                return M68K_BE_32(__atomic_load_n((uint32_t*)MEM_PTR, __ATOMIC_RELAXED));
 
-        if(MEM_BASE->BUFFER == NULL)
-        {
-            VERBOSE_TRACE("UNALLOCATED BUFFER AT INDEX %d\n", INDEX);
-            return NULL;
-        }
+            return (MEM_LOAD_SHARED(MEM_PTR, MEM_SIZE_16) << 16) | MEM_LOAD_SHARED(MEM_PTR + 2, MEM_SIZE_16);
 
-        // CHECK IF:
-        // 1. THE REQUESTED ADDRESS IS >= THE BUFFER'S BASE ADDRESS
-        // 2. THE OFFSET FROM BASE ADDRESS IS WITHIN THE BUFFER'S SIZE
+        case MEM_SIZE_16:
+            if(!(HOST & 1))
+                return M68K_BE_16(__atomic_load_n((uint16_t*)MEM_PTR, __ATOMIC_RELAXED));
 
-        if((MEM_BASE->BUFFER != NULL) && 
-                (ADDRESS >= MEM_BASE->BASE) && 
-                (ADDRESS < (MEM_BASE->BASE + MEM_BASE->SIZE)))
-        {
-            VERBOSE_TRACE("ACCESSED: 0x%08X [%s] IN BUFFER %u: 0x%08X - 0x%08X\n", 
-                ADDRESS, 
-                MEM_BASE->WRITE ? "RW" : "RO", 
-                INDEX, 
-                MEM_BASE->BASE, 
-                MEM_BASE->BASE + MEM_BASE->SIZE - 1);
+            return (MEM_LOAD_SHARED(MEM_PTR, MEM_SIZE_8) << 8) | MEM_LOAD_SHARED(MEM_PTR + 1, MEM_SIZE_8);
 
-            return MEM_BASE;
-        }
+        default:
+            return __atomic_load_n(MEM_PTR, __ATOMIC_RELAXED);
     }
-
-    VERBOSE_TRACE("NO BUFFER FOUND FOR ADDRESS: 0x%08X\n", ADDRESS);
-    return NULL;
 }
 
-// TRIGGER THE CORRESPONDING BUS ERROR BASED ON IT'S RESPECTIVE TYPE
-// HELPS TO DYNAMICALLY ASSERT WHICH CURRENT SOFTWARE COROUTINE IS BEING THROWN
-//
-// AUTOMATICALLY PRESUPPOES THE CURRENT ADDRESSS TO THE ACTUAL LOCATION
-// OF THE ERROR BEING THROWN AND CORRESPOND THAT TO THE CURRENT LINE LEVEL
-static void BUS_ERROR(M68K_BERR_TYPE TYPE, uint32_t ADDRESS, M68K_MEM_OP MEM_OP, uint32_t SIZE)
+static void MEM_STORE_SHARED(uint8_t* MEM_PTR, uint32_t SIZE, uint32_t VALUE)
 {
-    // CHECK FOR ACTIVITY
-    // PRESUPPOSES DOUBLE FAULT FOR LOOKING INTO VECTOR 2
-    // OF THE PULSE LINES
-    if(BERR_STATE.ACTIVE && !BERR_STATE.HALT_LINE)
+    uintptr_t HOST = (uintptr_t)MEM_PTR;
+
+    switch (SIZE)
     {
-        BERR_STATE.DOUBLE_FAULT = true;
-        BERR_STATE.TYPE = TYPE;
+        case MEM_SIZE_32:
+            if(!(HOST & 3))
+            {
+                __atomic_store_n((uint32_t*)MEM_PTR, M68K_BE_32(VALUE), __ATOMIC_RELAXED);
+                break;
+            }
 
-        MEM_ERROR(MEM_ERR_BERR, SIZE, "ORIGINAL FAULT AT 0x%08X\n", BERR_STATE.CURRENT_ADDRESS);
-        MEM_ERROR(MEM_ERR_BERR, SIZE, "NEW FAULT AT 0x%08X\n", ADDRESS);
+            MEM_STORE_SHARED(MEM_PTR, MEM_SIZE_16, VALUE >> 16);
+            MEM_STORE_SHARED(MEM_PTR + 2, MEM_SIZE_16, VALUE);
+            break;
 
-        M68K_STOPPED = 1;
-        return;
-    }
+        case MEM_SIZE_16:
+            if(!(HOST & 1))
+            {
+                __atomic_store_n((uint16_t*)MEM_PTR, M68K_BE_16(VALUE), __ATOMIC_RELAXED);
+                break;
+            }
 
-    BERR_STATE.ACTIVE = true;
-    BERR_STATE.TYPE = TYPE;
-    BERR_STATE.CURRENT_ADDRESS = ADDRESS;
-    BERR_STATE.OP = MEM_OP;
-    BERR_STATE.ACCESS_SIZE = SIZE;
-    BERR_STATE.FAULT_COUNT++;
+            MEM_STORE_SHARED(MEM_PTR, MEM_SIZE_8, VALUE >> 8);
+            MEM_STORE_SHARED(MEM_PTR + 1, MEM_SIZE_8, VALUE);
+            break;
+
+        default:
+            __atomic_store_n(MEM_PTR, (uint8_t)(VALUE & M68K_LSB_MASK), __ATOMIC_RELAXED);
+            break;
+    }
 }
 
-// DEFINE A HELPER FUNCTION FOR BEING ABLE TO PLUG IN ANY RESPECTIVE
-// ADDRESS AND SIZE BASED ON THE PRE-REQUISITE SIZING OF THE ENUM
+// AN OPERAND WHICH ISN'T NATURALLY ALIGNED ON THE HOST (A LONG ON A WORD BOUNDARY, WHICH THE
+// BUS HAPPILY ACCEPTS) CAN'T BE SWAPPED BY A SINGLE HOST INSTRUCTION - SUCH LOCKED CYCLES ARE
+// INSTEAD SERIALISED BEHIND ONE BUS LOCK, AND PERFORMED AS A LOAD AND A STORE
+//
+// THEY ARE INDIVISIBLE WITH RESPECT TO EACH OTHER. A PLAIN ACCESS (OR AN ALIGNED LOCKED CYCLE) TO THE
+// SAME BYTES MAY STILL LAND BETWEEN THE TWO HALVES, MUCH AS IT COULD BETWEEN THE TWO WORD CYCLES
+// OF A LONG ON THE 68000
 
-static uint32_t MEMORY_READ(uint32_t ADDRESS, uint32_t SIZE)
+static uint8_t MEM_RMW_LOCK = 0;
+
+#define         MEM_RMW_ACQUIRE()               while(__atomic_test_and_set(&MEM_RMW_LOCK, __ATOMIC_ACQUIRE))
+#define         MEM_RMW_RELEASE()               __atomic_clear(&MEM_RMW_LOCK, __ATOMIC_RELEASE)
+#define         MEM_RMW_MASK(SIZE)              (((SIZE) == MEM_SIZE_32) ? ~(uint32_t)0 : ((1U << (SIZE)) - 1))
+
+static bool MEM_CAS_SERIAL(uint8_t* MEM_PTR, uint32_t SIZE, uint32_t* EXPECTED, uint32_t DESIRED)
 {
-    VERBOSE_TRACE("ATTEMPTING TO READ ADDRESS: 0x%08X (SIZE = %d)\n", ADDRESS, SIZE);
+    uint32_t MASK = MEM_RMW_MASK(SIZE);
 
-    // CHECK FOR POSSIBLE ALIGNMENT ISSUES WITHIN THE BUS HANDLER
-    if(!M68K_BUS_ALIGNMENT(ADDRESS, SIZE))
-    {
-        BUS_ERROR(BERR_ALIGN, ADDRESS, MEM_READ, SIZE);
-        MEM_ERROR(MEM_ERR_ALIGN, SIZE, "MISALIGNED ADDRESS AT: 0x%08X", ADDRESS);
-        goto MALFORMED_READ;
-    }
+    MEM_RMW_ACQUIRE();
 
-    // BOUND CHECKS FOR INVALID ADDRESSING
-    if(ADDRESS > M68K_MAX_ADDR_END || ADDRESS > M68K_MAX_MEMORY_SIZE)
-    {
-        BUS_ERROR(BERR_BOUNDS, ADDRESS, MEM_READ, SIZE);
-        MEM_ERROR(MEM_ERR_RESERVED, SIZE, "ATTEMPT TO READ FROM RESERVED ADDRESS RANGE: 0x%08X", ADDRESS);
-        MEM_ERROR(MEM_ERR_BOUNDS, SIZE, "ATTEMPT TO READ FROM AN ADDRESS RANGE BEYOND THE ADDRESSABLE SPACE: 0x%08X", ADDRESS);
-        goto MALFORMED_READ;
-    }
+    uint32_t OLD = MEM_LOAD_SHARED(MEM_PTR, SIZE);
+    bool RESULT = (OLD == (*EXPECTED & MASK));
 
-    // FIND THE ADDRESS AND IT'S RELEVANT SIZE IN ACCORDANCE WITH WHICH VALUE IS BEING PROC.
-    M68K_MEM_BUFFER* MEM_BASE = MEM_FIND(ADDRESS);
+    if(RESULT)
+        MEM_STORE_SHARED(MEM_PTR, SIZE, DESIRED);
 
-    if(MEM_BASE != NULL)
+    MEM_RMW_RELEASE();
+
+    *EXPECTED = OLD;
+    return RESULT;
+}
+
+// COMPARE AND SWAP AN OPERAND IN PLACE
+// ON FAILURE, EXPECTED IS UPDATED WITH THE VALUE THAT WAS ACTUALLY PRESENT
+
+static bool MEM_CAS_SHARED(uint8_t* MEM_PTR, uint32_t SIZE, uint32_t* EXPECTED, uint32_t DESIRED)
+{
+    bool RESULT = false;
+
+    if((uintptr_t)MEM_PTR & ((SIZE / 8) - 1))
+        return MEM_CAS_SERIAL(MEM_PTR, SIZE, EXPECTED, DESIRED);
+
+    switch (SIZE)
     {
-        uint32_t OFFSET = (ADDRESS - MEM_BASE->BASE);
-        uint32_t BYTES = SIZE / 8;
+        case MEM_SIZE_32:
+        {
+            uint32_t OLD = M68K_BE_32(*EXPECTED);
+            RESULT = __atomic_compare_exchange_n((uint32_t*)MEM_PTR, &OLD, M68K_BE_32(DESIRED),
+                        false, __ATOMIC_SEQ_CST, __ATOMIC_SEQ_CST);
+            *EXPECTED = M68K_BE_32(OLD);
+            break;
+        }
 
-        if((OFFSET + BYTES + 1) > MEM_BASE->SIZE)
+        case MEM_SIZE_16:
         {
-            MEM_BASE->USAGE.VIOLATION++;
-            MEM_BASE->USAGE.BUS_ERROR++;
-            BUS_ERROR(BERR_BOUNDS, ADDRESS, MEM_READ, SIZE);
-            MEM_ERROR(MEM_ERR_BOUNDS, SIZE, "READ OUT OF BOUNDS: OFFSET = %d, SIZE = %d, VIOLATION #%u", OFFSET, BYTES, MEM_BASE->USAGE.VIOLATION);
-            goto MALFORMED_READ;
+            uint16_t OLD = M68K_BE_16(*EXPECTED);
+            RESULT = __atomic_compare_exchange_n((uint16_t*)MEM_PTR, &OLD, M68K_BE_16(DESIRED),
+                        false, __ATOMIC_SEQ_CST, __ATOMIC_SEQ_CST);
+            *EXPECTED = M68K_BE_16(OLD);
+            break;
         }
 
-        // DETERMINE IF THE BERR PULSE LINE IS ENABLED FOR THIS BUFFER
-        if(MEM_BASE->BERR && BERR_STATE.ACTIVE)
+        default:
         {
-            MEM_BASE->USAGE.BUS_ERROR++;
-            MEM_ERROR(MEM_ERR_BERR, SIZE, "BERR ACTIVE FOR CURRENT BUFFER: %u", MEM_BASE->BUFFER);
-            goto MALFORMED_READ;
+            uint8_t OLD = (uint8_t)*EXPECTED;
+            RESULT = __atomic_compare_exchange_n(MEM_PTR, &OLD, (uint8_t)DESIRED,
+                        false, __ATOMIC_SEQ_CST, __ATOMIC_SEQ_CST);
+            *EXPECTED = OLD;
+            break;
         }
+    }
 
-        // FIRST WE READ AND DETERMINE THE READ STATISTICS OF THE CURRENT MEMORY MAP BEING ALLOCATED
+    return RESULT;
+}
+
+/////////////////////////////////////////////////////
+//                 REGION HASHING
+/////////////////////////////////////////////////////
+
+// XXHASH64 - SMALL, FAST AND WELL DISTRIBUTED, WHICH IS ALL THAT IS NEEDED
+// TO TELL TWO BUS STATES APART (THIS IS NOT A CRYPTOGRAPHIC FINGERPRINT)
+
+#define         XXH_PRIME64_1                   0x9E3779B185EBCA87ULL
+#define         XXH_PRIME64_2                   0xC2B2AE3D27D4EB4FULL
+#define         XXH_PRIME64_3                   0x165667B19E3779F9ULL
+#define         XXH_PRIME64_4                   0x85EBCA77C2B2AE63ULL
+#define         XXH_PRIME64_5                   0x27D4EB2F165667C5ULL
+
+#define         XXH_ROTL64(VALUE, SHIFT)        (((VALUE) << (SHIFT)) | ((VALUE) >> (64 - (SHIFT))))
+
+static inline uint64_t XXH_READ64(const uint8_t* PTR)
+{
+    uint64_t VALUE;
+    memcpy(&VALUE, PTR, sizeof(VALUE));
+
+#if defined(__BYTE_ORDER__) && (__BYTE_ORDER__ == __ORDER_BIG_ENDIAN__)
+    VALUE = __builtin_bswap64(VALUE);
+#endif
+    return VALUE;
+}
+
+static inline uint32_t XXH_READ32(const uint8_t* PTR)
+{
+    uint32_t VALUE;
+    memcpy(&VALUE, PTR, sizeof(VALUE));
+
+#if defined(__BYTE_ORDER__) && (__BYTE_ORDER__ == __ORDER_BIG_ENDIAN__)
+    VALUE = __builtin_bswap32(VALUE);
+#endif
+    return VALUE;
+}
+
+static inline uint64_t XXH_ROUND(uint64_t ACC, uint64_t INPUT)
+{
+    ACC += INPUT * XXH_PRIME64_2;
+    ACC = XXH_ROTL64(ACC, 31);
+    return ACC * XXH_PRIME64_1;
+}
+
+static inline uint64_t XXH_MERGE(uint64_t ACC, uint64_t VALUE)
+{
+    ACC ^= XXH_ROUND(0, VALUE);
+    return ACC * XXH_PRIME64_1 + XXH_PRIME64_4;
+}
+
+static uint64_t XXH64(const uint8_t* DATA, size_t LENGTH, uint64_t SEED)
+{
+    const uint8_t* END = DATA + LENGTH;
+    uint64_t HASH;
+
+    if(LENGTH >= 32)
+    {
+        uint64_t V1 = SEED + XXH_PRIME64_1 + XXH_PRIME64_2;
+        uint64_t V2 = SEED + XXH_PRIME64_2;
+        uint64_t V3 = SEED;
+        uint64_t V4 = SEED - XXH_PRIME64_1;
+
+        do
+        {
+            V1 = XXH_ROUND(V1, XXH_READ64(DATA));
+            V2 = XXH_ROUND(V2, XXH_READ64(DATA + 8));
+            V3 = XXH_ROUND(V3, XXH_READ64(DATA + 16));
+            V4 = XXH_ROUND(V4, XXH_READ64(DATA + 24));
+            DATA += 32;
+
+        } while(DATA <= END - 32);
+
+        HASH = XXH_ROTL64(V1, 1) + XXH_ROTL64(V2, 7) + XXH_ROTL64(V3, 12) + XXH_ROTL64(V4, 18);
+        HASH = XXH_MERGE(HASH, V1);
+        HASH = XXH_MERGE(HASH, V2);
+        HASH = XXH_MERGE(HASH, V3);
+        HASH = XXH_MERGE(HASH, V4);
+    }
+    else
+    {
+        HASH = SEED + XXH_PRIME64_5;
+    }
+
+    HASH += (uint64_t)LENGTH;
+
+    for(; DATA + 8 <= END; DATA += 8)
+    {
+        HASH ^= XXH_ROUND(0, XXH_READ64(DATA));
+        HASH = XXH_ROTL64(HASH, 27) * XXH_PRIME64_1 + XXH_PRIME64_4;
+    }
+
+    if(DATA + 4 <= END)
+    {
+        HASH ^= (uint64_t)XXH_READ32(DATA) * XXH_PRIME64_1;
+        HASH = XXH_ROTL64(HASH, 23) * XXH_PRIME64_2 + XXH_PRIME64_3;
+        DATA += 4;
+    }
+
+    for(; DATA < END; DATA++)
+    {
+        HASH ^= (*DATA) * XXH_PRIME64_5;
+        HASH = XXH_ROTL64(HASH, 11) * XXH_PRIME64_1;
+    }
+
+    HASH ^= HASH >> 33;
+    HASH *= XXH_PRIME64_2;
+    HASH ^= HASH >> 29;
+    HASH *= XXH_PRIME64_3;
+    HASH ^= HASH >> 32;
+    return HASH;
+}
+
+static inline uint64_t MEM_HASH_COMBINE(uint64_t LEFT, uint64_t RIGHT)
+{
+    uint64_t PAIR[2] = { LEFT, RIGHT };
+    return XXH64((const uint8_t*)PAIR, sizeof(PAIR), 0);
+}
+
+// FLAG THE PAGES COVERED BY A WRITE AS NEEDING TO BE REHASHED - ALWAYS AFTER THE STORE, AND WITH
+// RELEASE ORDERING ON SHARED REGIONS, SO THAT WHICHEVER REHASH CLEARS THE BIT ALSO SEES THE NEW BYTES
+//
+// THE TREE IS ONLY ALLOCATED ON THE FIRST QUERY, SO UNTIL THEN THIS COSTS A SINGLE NULL CHECK
+
+static inline void MEM_HASH_MARK(M68K_MEM_BUFFER* BUF, uint32_t OFFSET, uint32_t BYTES)
+{
+    uint64_t* DIRTY = __atomic_load_n(&BUF->HASH.DIRTY, __ATOMIC_ACQUIRE);
+
+    if(DIRTY == NULL)
+        return;
+
+    uint32_t FIRST = OFFSET >> M68K_HASH_PAGE_SHIFT;
+    uint32_t LAST = (OFFSET + BYTES - 1) >> M68K_HASH_PAGE_SHIFT;
+
+    if(LAST >= BUF->HASH.PAGES)
+        LAST = BUF->HASH.PAGES - 1;
+
+    for(uint32_t PAGE = FIRST; PAGE <= LAST; PAGE++)
+    {
+        uint64_t BIT = 1ULL << (PAGE & 63);
+
+        if(BUF->FLAGS & M68K_MAP_SHARED)
+            __atomic_fetch_or(&DIRTY[PAGE >> 6], BIT, __ATOMIC_RELEASE);
+        else
+            DIRTY[PAGE >> 6] |= BIT;
+    }
+}
+
+static bool MEM_HASH_INIT(M68K_MEM_BUFFER* BUF)
+{
+    M68K_MEM_HASH* HASH = &BUF->HASH;
+
+    HASH->PAGES = (BUF->SIZE + M68K_HASH_PAGE_SIZE - 1) >> M68K_HASH_PAGE_SHIFT;
+    HASH->LEAVES = 1;
+
+    while(HASH->LEAVES < HASH->PAGES)
+        HASH->LEAVES <<= 1;
+
+    uint32_t WORDS = (HASH->PAGES + 63) / 64;
+    uint64_t* DIRTY = malloc(WORDS * sizeof(uint64_t));
+    HASH->NODES = calloc(HASH->LEAVES * 2, sizeof(uint64_t));
+
+    if(DIRTY == NULL || HASH->NODES == NULL)
+    {
+        free(DIRTY);
+        free(HASH->NODES);
+        HASH->NODES = NULL;
+        return false;
+    }
+
+    // EVERY PAGE STARTS DIRTY SO THE FIRST QUERY HASHES THE WHOLE REGION
+    // (BAR THE BITS OF THE LAST WORD WHICH LIE BEYOND IT)
+
+    memset(DIRTY, 0xFF, WORDS * sizeof(uint64_t));
+
+    if(HASH->PAGES & 63)
+        DIRTY[WORDS - 1] = (1ULL << (HASH->PAGES & 63)) - 1;
+    __atomic_store_n(&HASH->DIRTY, DIRTY, __ATOMIC_RELEASE);
+    return true;
+}
+
+// REHASH EVERY DIRTY PAGE AND THE PATH FROM IT UP TO THE ROOT
+// THIS IS EXPECTED TO BE CALLED FROM THE 68K SIDE, BETWEEN FRAMES
+
+static void MEM_HASH_UPDATE(M68K_MEM_BUFFER* BUF)
+{
+    M68K_MEM_HASH* HASH = &BUF->HASH;
+
+    if(HASH->NODES == NULL && !MEM_HASH_INIT(BUF))
+        return;
+
+    for(uint32_t WORD = 0; WORD < (HASH->PAGES + 63) / 64; WORD++)
+    {
+        uint64_t BITS = __atomic_exchange_n(&HASH->DIRTY[WORD], 0, __ATOMIC_ACQUIRE);
+
+        while(BITS)
+        {
+            uint32_t PAGE = (WORD * 64) + __builtin_ctzll(BITS);
+            uint32_t OFFSET = PAGE << M68K_HASH_PAGE_SHIFT;
+            uint32_t LENGTH = (BUF->SIZE - OFFSET) < M68K_HASH_PAGE_SIZE ? (BUF->SIZE - OFFSET) : M68K_HASH_PAGE_SIZE;
+
+            BITS &= BITS - 1;
+            HASH->NODES[HASH->LEAVES + PAGE] = XXH64(BUF->BUFFER + OFFSET, LENGTH, PAGE);
+
+            for(uint32_t NODE = (HASH->LEAVES + PAGE) >> 1; NODE != 0; NODE >>= 1)
+            {
+                HASH->NODES[NODE] = MEM_HASH_COMBINE(HASH->NODES[NODE * 2], HASH->NODES[NODE * 2 + 1]);
+            }
+        }
+    }
+}
+
+uint64_t MEMORY_HASH_ROOT(M68K_MEM_BUFFER* BUF)
+{
+    MEM_HASH_UPDATE(BUF);
+    return (BUF->HASH.NODES != NULL) ? BUF->HASH.NODES[1] : 0;
+}
+
+// FINGERPRINT OF THE WHOLE BUS - THE LAYOUT OF EACH REGION IS
+// FOLDED IN ALONGSIDE IT'S ROOT, SO TWO DIFFERENT MAPS NEVER COMPARE EQUAL
+
+static uint64_t MEM_HASH_FOLD(uint64_t ACC, M68K_MEM_BUFFER* BUF)
+{
+    uint64_t REGION[3] = 
+    {
+        ((uint64_t)BUF->BASE << 32) | BUF->END,
+        ((uint64_t)BUF->WRITE << 1) | BUF->BERR,
+        MEMORY_HASH_ROOT(BUF)
+    };
+
+    return MEM_HASH_COMBINE(ACC, XXH64((const uint8_t*)REGION, sizeof(REGION), 0));
+}
+
+uint64_t BUS_HASH(void)
+{
+    uint64_t ACC = 0;
+
+    for(unsigned INDEX = 0; INDEX < MEM_NUM_BUFFERS; INDEX++)
+    {
+        ACC = MEM_HASH_FOLD(ACC, &MEM_BUFFERS[INDEX]);
+    }
+
+#if STATIC_MAP_HOOK == M68K_OPT_ON
+    for(unsigned INDEX = 0; INDEX < STATIC_NUM_REGIONS; INDEX++)
+    {
+        ACC = MEM_HASH_FOLD(ACC, &STATIC_BUFFERS[INDEX]);
+    }
+#endif
+
+    return ACC;
+}
+
+// TAKE A COPY OF A REGION'S (UP TO DATE) TREE, TO BE DIFFED AGAINST LATER
+// OR AGAINST THE TREE OF ANOTHER BUILD - RELEASED WITH MEMORY_HASH_FREE
+
+bool MEMORY_HASH_SNAPSHOT(M68K_MEM_BUFFER* BUF, M68K_MEM_HASH* OUT)
+{
+    memset(OUT, 0, sizeof(*OUT));
+    MEM_HASH_UPDATE(BUF);
+
+    if(BUF->HASH.NODES == NULL)
+        return false;
+
+    OUT->PAGES = BUF->HASH.PAGES;
+    OUT->LEAVES = BUF->HASH.LEAVES;
+    OUT->NODES = malloc(OUT->LEAVES * 2 * sizeof(uint64_t));
+
+    if(OUT->NODES == NULL)
+        return false;
+
+    memcpy(OUT->NODES, BUF->HASH.NODES, OUT->LEAVES * 2 * sizeof(uint64_t));
+    return true;
+}
+
+void MEMORY_HASH_FREE(M68K_MEM_HASH* HASH)
+{
+    free(HASH->NODES);
+    free(HASH->DIRTY);
+    memset(HASH, 0, sizeof(*HASH));
+}
+
+static unsigned MEM_HASH_DIFF_NODE(const M68K_MEM_HASH* A, const M68K_MEM_HASH* B, uint32_t NODE, 
+                                    uint32_t* PAGES, unsigned MAX, unsigned COUNT)
+{
+    if(COUNT >= MAX || A->NODES[NODE] == B->NODES[NODE])
+        return COUNT;
+
+    if(NODE >= A->LEAVES)
+    {
+        PAGES[COUNT++] = NODE - A->LEAVES;
+        return COUNT;
+    }
+
+    COUNT = MEM_HASH_DIFF_NODE(A, B, NODE * 2, PAGES, MAX, COUNT);
+    return MEM_HASH_DIFF_NODE(A, B, NODE * 2 + 1, PAGES, MAX, COUNT);
+}
+
+// WALK BOTH TREES FROM THE ROOT, ONLY DESCENDING WHERE THE HASHES DISAGREE
+// RETURNS THE NUMBER OF DIFFERING PAGES WRITTEN OUT (IN ASCENDING ORDER, UP TO MAX)
+//
+// TREES OF A DIFFERENT SHAPE CAN'T BE COMPARED PAGE FOR PAGE, SO EVERY PAGE IS REPORTED
+
+unsigned MEMORY_HASH_DIFF(const M68K_MEM_HASH* A, const M68K_MEM_HASH* B, uint32_t* PAGES, unsigned MAX)
+{
+    unsigned COUNT = 0;
+
+    if(A->NODES == NULL || B->NODES == NULL || A->LEAVES != B->LEAVES || A->PAGES != B->PAGES)
+    {
+        for(uint32_t PAGE = 0; PAGE < A->PAGES && COUNT < MAX; PAGE++)
+            PAGES[COUNT++] = PAGE;
+
+        return COUNT;
+    }
+
+    return MEM_HASH_DIFF_NODE(A, B, 1, PAGES, MAX, 0);
+}
+
+/////////////////////////////////////////////////////
+//             BUS ERROR EVENT QUEUE
+/////////////////////////////////////////////////////
+
+// A DEVICE THREAD FAULTING ON A SHARED REGION PUSHES HERE JUST AS THE 68K SIDE DOES, SO THE QUEUE
+// TAKES ANY NUMBER OF PRODUCERS - A PUSH CLAIMS A SLOT BY ADVANCING TAIL, FILLS IT IN AND ONLY THEN
+// PUBLISHES IT THROUGH IT'S SEQUENCE NUMBER. THE COUNTERS ARE RELAXED ATOMICS
+//
+// PEEKING, DRAINING AND RESETTING REMAIN THE JOB OF THE 68K SIDE ALONE
+
+#define         BERR_SLOT(POS)                  (&BERR_QUEUE.SLOTS[(POS) & (M68K_BERR_QUEUE_SIZE - 1)])
+#define         BERR_SLOT_SEQ(POS)              (__atomic_load_n(&BERR_SLOT(POS)->SEQ, __ATOMIC_ACQUIRE) + ((POS) & (M68K_BERR_QUEUE_SIZE - 1)))
+#define         BERR_SLOT_PUBLISH(POS, NEXT)    __atomic_store_n(&BERR_SLOT(POS)->SEQ, (NEXT) - ((POS) & (M68K_BERR_QUEUE_SIZE - 1)), __ATOMIC_RELEASE)
+
+// RECORD A FAULTING ACCESS - KEPT OUT OF LINE AND COLD SO THE
+// VALIDATION BRANCHES OF THE ACCESSORS STAY AS CHEAP AS POSSIBLE
+//
+// DOUBLE_FAULT BELONGS TO THIS ACCESS ALONE, AS SAID BY BUS_ERROR WHEN IT RAISED THE LINE
+
+__attribute__((cold, noinline))
+static void BERR_EVENT_PUSH(M68K_BERR_TYPE TYPE, M68K_MEM_ERROR ERROR, uint32_t ADDRESS, uint32_t SIZE, M68K_MEM_OP OP, bool DOUBLE_FAULT)
+{
+    __atomic_fetch_add(&BERR_QUEUE.TYPE_COUNT[TYPE], 1, __ATOMIC_RELAXED);
+    __atomic_fetch_add(&BERR_QUEUE.ERROR_COUNT[ERROR], 1, __ATOMIC_RELAXED);
+
+#if LATENCY_HOOK == M68K_OPT_ON
+    if(MEM_LATENCY_SAMPLE.FAULT == MEM_OK)
+        MEM_LATENCY_SAMPLE.FAULT = ERROR;
+#endif
+
+    uint32_t POS = __atomic_load_n(&BERR_QUEUE.TAIL, __ATOMIC_RELAXED);
+
+    for(;;)
+    {
+        int32_t DIFF = (int32_t)(BERR_SLOT_SEQ(POS) - POS);
+
+        if(DIFF < 0)
+        {
+            __atomic_fetch_add(&BERR_QUEUE.DROPPED, 1, __ATOMIC_RELAXED);
+            return;
+        }
+
+        if(DIFF == 0 && __atomic_compare_exchange_n(&BERR_QUEUE.TAIL, &POS, POS + 1, true, __ATOMIC_RELAXED, __ATOMIC_RELAXED))
+            break;
+
+        if(DIFF > 0)
+            POS = __atomic_load_n(&BERR_QUEUE.TAIL, __ATOMIC_RELAXED);
+    }
+
+    M68K_BERR_EVENT* EVENT = &BERR_SLOT(POS)->EVENT;
+    EVENT->TYPE = TYPE;
+    EVENT->ERROR = ERROR;
+    EVENT->OP = OP;
+    EVENT->ADDRESS = ADDRESS;
+    EVENT->SIZE = SIZE;
+    EVENT->PC = M68K_PC;
+    EVENT->DOUBLE_FAULT = DOUBLE_FAULT;
+
+    BERR_SLOT_PUBLISH(POS, POS + 1);
+}
+
+#define         MEM_FAULT(TYPE, ERROR, OP)          BERR_EVENT_PUSH((TYPE), (ERROR), ADDRESS, SIZE, (OP), false)
+#define         MEM_BUS_FAULT(TYPE, ERROR, OP)      BERR_EVENT_PUSH((TYPE), (ERROR), ADDRESS, SIZE, (OP), BUS_ERROR((TYPE), ADDRESS, (OP), SIZE))
+
+// THE NUMBER OF SLOTS CLAIMED - WHICH MAY INCLUDE AN EVENT ANOTHER THREAD IS STILL FILLING IN
+
+unsigned BERR_QUEUE_COUNT(void)
+{
+    return __atomic_load_n(&BERR_QUEUE.TAIL, __ATOMIC_RELAXED) - BERR_QUEUE.HEAD;
+}
+
+// LOOK AT AN EVENT WITHOUT REMOVING IT, INDEX 0 BEING THE OLDEST
+
+bool BERR_QUEUE_PEEK(unsigned INDEX, M68K_BERR_EVENT* EVENT)
+{
+    uint32_t POS = BERR_QUEUE.HEAD + INDEX;
+
+    if(INDEX >= BERR_QUEUE_COUNT() || BERR_SLOT_SEQ(POS) != POS + 1)
+        return false;
+
+    *EVENT = BERR_SLOT(POS)->EVENT;
+    return true;
+}
+
+// REMOVE UP TO MAX OF THE OLDEST EVENTS, RETURNING HOW MANY WERE DRAINED
+// PASSING NULL SIMPLY DISCARDS THEM
+
+unsigned BERR_QUEUE_DRAIN(M68K_BERR_EVENT* EVENTS, unsigned MAX)
+{
+    unsigned COUNT = 0;
+
+    while(COUNT < MAX && BERR_SLOT_SEQ(BERR_QUEUE.HEAD) == BERR_QUEUE.HEAD + 1)
+    {
+        uint32_t POS = BERR_QUEUE.HEAD;
+
+        if(EVENTS != NULL)
+            EVENTS[COUNT] = BERR_SLOT(POS)->EVENT;
+
+        BERR_SLOT_PUBLISH(POS, POS + M68K_BERR_QUEUE_SIZE);
+        BERR_QUEUE.HEAD++;
+        COUNT++;
+    }
+
+    return COUNT;
+}
+
+void BERR_QUEUE_RESET(void)
+{
+    memset(&BERR_QUEUE, 0, sizeof(BERR_QUEUE));
+}
+
+// THE DEFERRED TEXT FORMATTING - DRAINS THE QUEUE AND PRINTS
+// EACH EVENT ALONGSIDE THE RUNNING COUNTERS FOR EACH TYPE OF FAULT
+
+void SHOW_BERR_EVENTS(void)
+{
+    M68K_BERR_EVENT EVENT;
+
+    printf("\nBUS ERROR EVENTS: %u QUEUED, %u DROPPED\n", BERR_QUEUE_COUNT(), __atomic_load_n(&BERR_QUEUE.DROPPED, __ATOMIC_RELAXED));
+    printf("------------------------------------------------------------------------------------------------------\n");
+    printf("OP  ADDRESS     SIZE  PC          TYPE              ERROR\n");
+    printf("------------------------------------------------------------------------------------------------------\n");
+
+    while(BERR_QUEUE_DRAIN(&EVENT, 1))
+    {
+        printf("%c   0x%08X  %4u  0x%08X  %-16s  %s%s\n",
+                (char)EVENT.OP,
+                EVENT.ADDRESS,
+                EVENT.SIZE,
+                EVENT.PC,
+                M68K_BERR_ERR[EVENT.TYPE],
+                M68K_MEM_ERR[EVENT.ERROR],
+                EVENT.DOUBLE_FAULT ? " (DOUBLE FAULT)" : "");
+    }
+
+    printf("------------------------------------------------------------------------------------------------------\n");
+
+    for(unsigned TYPE = BERR_NONE; TYPE <= BERR_DOUBLE_FAULT; TYPE++)
+    {
+        uint32_t COUNT = __atomic_load_n(&BERR_QUEUE.TYPE_COUNT[TYPE], __ATOMIC_RELAXED);
+
+        if(COUNT)
+            printf("%-16s  %u\n", M68K_BERR_ERR[TYPE], COUNT);
+    }
+}
+
+/////////////////////////////////////////////////////
+//             MEMORY READ AND WRITE
+/////////////////////////////////////////////////////
+
+static M68K_MEM_BUFFER* MEM_FIND(uint32_t ADDRESS)
+{
+    VERBOSE_TRACE("FOUND MEMORY: 0x%04X", ADDRESS);
+
+    // ITERATE THROUGH ALL REGISTERED MEMORY BUFFERS
+    for(unsigned INDEX = 0; INDEX < MEM_NUM_BUFFERS; INDEX++)
+    {
+        // GET A POINTER TO THE CURRENT MEMORY BUFFER
+        M68K_MEM_BUFFER* MEM_BASE = MEM_BUFFERS + INDEX;
+
+        if(MEM_BASE->BUFFER == NULL)
+        {
+            VERBOSE_TRACE("UNALLOCATED BUFFER AT INDEX %d\n", INDEX);
+            return NULL;
+        }
+
+        // CHECK IF:
+        // 1. THE REQUESTED ADDRESS IS >= THE BUFFER'S BASE ADDRESS
+        // 2. THE OFFSET FROM BASE ADDRESS IS WITHIN THE BUFFER'S SIZE
+
+        if((MEM_BASE->BUFFER != NULL) && 
+                (ADDRESS >= MEM_BASE->BASE) && 
+                (ADDRESS < (MEM_BASE->BASE + MEM_BASE->SIZE)))
+        {
+            VERBOSE_TRACE("ACCESSED: 0x%08X [%s] IN BUFFER %u: 0x%08X - 0x%08X\n", 
+                ADDRESS, 
+                MEM_BASE->WRITE ? "RW" : "RO", 
+                INDEX, 
+                MEM_BASE->BASE, 
+                MEM_BASE->BASE + MEM_BASE->SIZE - 1);
+
+            return MEM_BASE;
+        }
+    }
+
+    VERBOSE_TRACE("NO BUFFER FOUND FOR ADDRESS: 0x%08X\n", ADDRESS);
+    return NULL;
+}
+
+#if STATIC_MAP_HOOK == M68K_OPT_ON
+
+// THE STATIC DECODER EXPANDS INTO ONE RANGE CHECK PER REGION AGAINST CONSTANTS, WHICH
+// THE COMPILER FOLDS DOWN (A SINGLE UNSIGNED COMPARE EACH) - NO TABLE WALK, NO NULL CHECKS
+//
+// REGIONS ARE TESTED IN TABLE ORDER, MATCHING THE FIRST-FIT BEHAVIOUR OF MEM_FIND
+
+#define STATIC_REGION_DECODE(NAME, LOW, HIGH, RW, ERR, MAP) \
+    if((uint32_t)(ADDRESS - (LOW)) <= (uint32_t)((HIGH) - (LOW))) \
+        return &STATIC_BUFFERS[STATIC_REGION_##NAME];
+
+static inline M68K_MEM_BUFFER* STATIC_MEM_FIND(uint32_t ADDRESS)
+{
+    M68K_STATIC_MEMORY_MAP(STATIC_REGION_DECODE)
+
+    return NULL;
+}
+
+#define         BUS_FIND(ADDRESS)                           STATIC_MEM_FIND(ADDRESS)
+#define         BUS_READ(ADDRESS, SIZE)                     STATIC_MEMORY_READ(ADDRESS, SIZE)
+#define         BUS_WRITE(ADDRESS, SIZE, VALUE)             STATIC_MEMORY_WRITE(ADDRESS, SIZE, VALUE)
+#define         BUS_REGION_TABLE                            STATIC_BUFFERS
+#define         BUS_REGION_COUNT                            STATIC_NUM_REGIONS
+
+#else
+
+#define         BUS_FIND(ADDRESS)                           MEM_FIND(ADDRESS)
+#define         BUS_READ(ADDRESS, SIZE)                     MEMORY_READ(ADDRESS, SIZE)
+#define         BUS_WRITE(ADDRESS, SIZE, VALUE)             MEMORY_WRITE(ADDRESS, SIZE, VALUE)
+#define         BUS_REGION_TABLE                            MEM_BUFFERS
+#define         BUS_REGION_COUNT                            MEM_NUM_BUFFERS
+
+#endif
+
+// THE THREAD WHICH OWNS THE BERR LATCH IS THE 68K SIDE - NAMED BY THE ADDRESS OF IT'S OWN THREAD LOCAL
+// MAPPING A REGION CLAIMS IT; A STATIC BUILD MAPS NOTHING, SO THERE THE FIRST THREAD TO FAULT OR
+// ACKNOWLEDGE TAKES IT, UNLESS THE 68K SIDE HAS CALLED BERR_CLAIM BEFORE STARTING ANY DEVICES
+
+void BERR_CLAIM(void)
+{
+    __atomic_store_n(&BERR_OWNER, (uintptr_t)&BERR_THREAD, __ATOMIC_RELAXED);
+}
+
+static inline bool BERR_LATCH_OWNER(void)
+{
+    uintptr_t OWNER = 0;
+
+    if(__atomic_compare_exchange_n(&BERR_OWNER, &OWNER, (uintptr_t)&BERR_THREAD, false, __ATOMIC_RELAXED, __ATOMIC_RELAXED))
+        return true;
+
+    return OWNER == (uintptr_t)&BERR_THREAD;
+}
+
+// TRIGGER THE CORRESPONDING BUS ERROR BASED ON IT'S RESPECTIVE TYPE
+// HELPS TO DYNAMICALLY ASSERT WHICH CURRENT SOFTWARE COROUTINE IS BEING THROWN
+//
+// AUTOMATICALLY PRESUPPOES THE CURRENT ADDRESSS TO THE ACTUAL LOCATION
+// OF THE ERROR BEING THROWN AND CORRESPOND THAT TO THE CURRENT LINE LEVEL
+//
+// RETURNS TRUE WHEN THIS FAULT LANDED ON A LINE ALREADY HELD AND DOUBLE FAULTED
+//
+// THE LATCH IS THE 68K'S OWN - A DEVICE THREAD FAULTING ON A SHARED REGION NEVER RAISES
+// THE LINE, IT'S FAULT IS ONLY EVER RECORDED WITHIN THE EVENT QUEUE
+static bool BUS_ERROR(M68K_BERR_TYPE TYPE, uint32_t ADDRESS, M68K_MEM_OP MEM_OP, uint32_t SIZE)
+{
+    if(!BERR_LATCH_OWNER())
+        return false;
+
+    // CHECK FOR ACTIVITY
+    // PRESUPPOSES DOUBLE FAULT FOR LOOKING INTO VECTOR 2
+    // OF THE PULSE LINES
+    if(BERR_STATE.ACTIVE && !BERR_STATE.HALT_LINE)
+    {
+        BERR_STATE.DOUBLE_FAULT = true;
+        BERR_STATE.TYPE = TYPE;
+
+        MEM_FAULT_ERROR(MEM_ERR_BERR, SIZE, "ORIGINAL FAULT AT 0x%08X\n", BERR_STATE.CURRENT_ADDRESS);
+        MEM_FAULT_ERROR(MEM_ERR_BERR, SIZE, "NEW FAULT AT 0x%08X\n", ADDRESS);
+
+        M68K_STOPPED = 1;
+        return true;
+    }
+
+    __atomic_store_n(&BERR_STATE.ACTIVE, true, __ATOMIC_RELAXED);
+    BERR_STATE.TYPE = TYPE;
+    BERR_STATE.CURRENT_ADDRESS = ADDRESS;
+    BERR_STATE.CURRENT_PC = M68K_PC;
+    BERR_STATE.OP = MEM_OP;
+    BERR_STATE.ACCESS_SIZE = SIZE;
+    BERR_STATE.FAULT_COUNT++;
+    return false;
+}
+
+// THE 68K HAS TAKEN THE BUS ERROR EXCEPTION - RELEASE THE LINE SO THAT
+// REGIONS WHICH HONOUR IT CAN BE ACCESSED AGAIN
+
+void BERR_ACKNOWLEDGE(void)
+{
+    if(!BERR_LATCH_OWNER())
+        return;
+
+    __atomic_store_n(&BERR_STATE.ACTIVE, false, __ATOMIC_RELAXED);
+    BERR_STATE.DOUBLE_FAULT = false;
+    BERR_STATE.TYPE = BERR_NONE;
+    M68K_STOPPED = 0;
+}
+
+// DEFINE A HELPER FUNCTION FOR BEING ABLE TO PLUG IN ANY RESPECTIVE
+// ADDRESS AND SIZE BASED ON THE PRE-REQUISITE SIZING OF THE ENUM
+//
+// THE REGION IS DECODED BY THE CALLER (MEM_FIND OR THE STATIC DECODER) SO THAT
+// BOTH PATHS SHARE THE SAME VALIDATION AND REPORT THE SAME ERRORS
+
+static inline uint32_t MEMORY_READ_REGION(M68K_MEM_BUFFER* MEM_BASE, uint32_t ADDRESS, uint32_t SIZE)
+{
+    VERBOSE_TRACE("ATTEMPTING TO READ ADDRESS: 0x%08X (SIZE = %d)\n", ADDRESS, SIZE);
+
+    // CHECK FOR POSSIBLE ALIGNMENT ISSUES WITHIN THE BUS HANDLER
+    if(!M68K_BUS_ALIGNMENT(ADDRESS, SIZE))
+    {
+        MEM_BUS_FAULT(BERR_ALIGN, MEM_ERR_ALIGN, MEM_READ);
+        MEM_FAULT_ERROR(MEM_ERR_ALIGN, SIZE, "MISALIGNED ADDRESS AT: 0x%08X", ADDRESS);
+        goto MALFORMED_READ;
+    }
+
+    // BOUND CHECKS FOR INVALID ADDRESSING
+    if(ADDRESS > M68K_MAX_ADDR_END || ADDRESS > M68K_MAX_MEMORY_SIZE)
+    {
+        MEM_BUS_FAULT(BERR_BOUNDS, MEM_ERR_RESERVED, MEM_READ);
+        MEM_FAULT_ERROR(MEM_ERR_RESERVED, SIZE, "ATTEMPT TO READ FROM RESERVED ADDRESS RANGE: 0x%08X", ADDRESS);
+        MEM_FAULT_ERROR(MEM_ERR_BOUNDS, SIZE, "ATTEMPT TO READ FROM AN ADDRESS RANGE BEYOND THE ADDRESSABLE SPACE: 0x%08X", ADDRESS);
+        goto MALFORMED_READ;
+    }
+
+    // FIND THE ADDRESS AND IT'S RELEVANT SIZE IN ACCORDANCE WITH WHICH VALUE IS BEING PROC.
+    if(MEM_BASE != NULL)
+    {
+        uint32_t OFFSET = (ADDRESS - MEM_BASE->BASE);
+        uint32_t BYTES = SIZE / 8;
+
+        if((OFFSET + BYTES) > MEM_BASE->SIZE)
+        {
+            MEM_USAGE_INC(MEM_BASE, VIOLATION);
+            MEM_USAGE_INC(MEM_BASE, BUS_ERROR);
+            MEM_BUS_FAULT(BERR_BOUNDS, MEM_ERR_BOUNDS, MEM_READ);
+            MEM_FAULT_ERROR(MEM_ERR_BOUNDS, SIZE, "READ OUT OF BOUNDS: OFFSET = %d, SIZE = %d, VIOLATION #%u", OFFSET, BYTES, MEM_BASE->USAGE->VIOLATION);
+            goto MALFORMED_READ;
+        }
+
+        // DETERMINE IF THE BERR PULSE LINE IS ENABLED FOR THIS BUFFER
+        if(MEM_BASE->BERR && BERR_LINE_ACTIVE())
+        {
+            MEM_USAGE_INC(MEM_BASE, BUS_ERROR);
+            MEM_FAULT(BERR_LINE_HELD, MEM_ERR_BERR, MEM_READ);
+            MEM_FAULT_ERROR(MEM_ERR_BERR, SIZE, "BERR ACTIVE FOR CURRENT BUFFER: %u", MEM_BASE->BUFFER);
+            goto MALFORMED_READ;
+        }
+
+        // FIRST WE READ AND DETERMINE THE READ STATISTICS OF THE CURRENT MEMORY MAP BEING ALLOCATED
+        // THIS CHECK COMES AFTER WHICH WE DETERMINE THE SIZE OF THE MEMORY REGION AS THIS IS TO
+        // AVOID POTENTIAL SPILL-OVERS WITH ADDITIONAL READS
+
+        MEM_USAGE_INC(MEM_BASE, READ_COUNT);
+        MEM_USAGE_SET(MEM_BASE, LAST_READ, ADDRESS);
+        MEM_USAGE_SET(MEM_BASE, ACCESSED, true);
+
+        // THIS MEMORY POINTER WILL ALLOCATE ITSELF RELATIVE TO THE BUFFER
+        // AS WELL AS THE BIT SHIFT OFFSET THAT IS PRESENT WITH THE RESPECTIVE BIT VALUE
+
+        uint8_t* MEM_PTR = MEM_BASE->BUFFER + OFFSET;
+        uint32_t MEM_RETURN = 0;
+
+        if(MEM_BASE->FLAGS & M68K_MAP_SHARED)
+        {
+            MEM_RETURN = MEM_LOAD_SHARED(MEM_PTR, SIZE);
+            MEM_TRACE("[READ]", ADDRESS, SIZE, MEM_RETURN);
+            return MEM_RETURN;
+        }
+
+        switch (SIZE)
+        {
+            case MEM_SIZE_32:
+                MEM_RETURN = *MEM_PTR++;
+                MEM_RETURN = (MEM_RETURN << 8) | *MEM_PTR++;
+                MEM_RETURN = (MEM_RETURN << 8) | *MEM_PTR++;
+                MEM_RETURN = (MEM_RETURN << 8) | *MEM_PTR;
+                break;
+                
+            case MEM_SIZE_16:
+                MEM_RETURN = *MEM_PTR++;
+                MEM_RETURN = (MEM_RETURN << 8) | *MEM_PTR;
+                break;
+                
+            case MEM_SIZE_8:
+                MEM_RETURN = *MEM_PTR;
+                break;
+        }
+        MEM_TRACE("[READ]", ADDRESS, SIZE, MEM_RETURN);
+        return MEM_RETURN;
+    }
+
+    MEM_BUS_FAULT(BERR_UNMAPPED_READ, MEM_ERR_UNMAPPED, MEM_READ);
+    MEM_FAULT_ERROR(MEM_ERR_UNMAPPED, SIZE, "NO BUFFER FOUND FOR ADDRESS: 0x%08X", ADDRESS);
+
+MALFORMED_READ:
+    MEM_FAULT_ERROR(MEM_ERR_BAD_READ, SIZE, "ADDRESS: 0x%08X", ADDRESS);
+    MEM_TRACE("[INVALID READ]", ADDRESS, SIZE, ~(uint32_t)0);
+    return 0;
+}
+
+static uint32_t MEMORY_READ(uint32_t ADDRESS, uint32_t SIZE)
+{
+    return MEMORY_READ_REGION(MEM_FIND(ADDRESS), ADDRESS, SIZE);
+}
+
+// NOW DO THE SAME FOR WRITES
+
+static inline void MEMORY_WRITE_REGION(M68K_MEM_BUFFER* MEM_BASE, uint32_t ADDRESS, uint32_t SIZE, uint32_t VALUE)
+{
+    VERBOSE_TRACE("ATTEMPTING WRITE TO ADDRESS: 0x%X (SIZE = %d, VALUE = 0x%X)\n", ADDRESS, SIZE, VALUE);
+
+    // CHECK FOR POSSIBLE ALIGNMENT ISSUES WITHIN THE BUS HANDLER
+    if(!M68K_BUS_ALIGNMENT(ADDRESS, SIZE))
+    {
+        MEM_FAULT(BERR_ALIGN, MEM_ERR_ALIGN, MEM_WRITE);
+        MEM_FAULT_ERROR(MEM_ERR_ALIGN, SIZE, "MISALIGNED ADDRESS AT: 0x%08X", ADDRESS);
+        goto MALFORMED_WRITE;
+    }
+
+    // BOUND CHECKS FOR INVALID ADDRESSING
+    if(ADDRESS > M68K_MAX_ADDR_END || ADDRESS > M68K_MAX_MEMORY_SIZE)
+    {
+        MEM_FAULT(BERR_BOUNDS, MEM_ERR_RESERVED, MEM_WRITE);
+        MEM_FAULT_ERROR(MEM_ERR_RESERVED, SIZE, "ATTEMPT TO WRITE TO RESERVED ADDRESS RANGE: 0x%X", ADDRESS);
+        MEM_FAULT_ERROR(MEM_ERR_BOUNDS, SIZE, "ATTEMPT TO WRITE TO AN ADDRESS RANGE BEYOND THE ADDRESSABLE SPACE: 0x%X", ADDRESS);
+        goto MALFORMED_WRITE;
+    }
+
+    if(MEM_BASE != NULL)
+    {
+        // BEFORE ANYTHING, WE NEED TO VALIDATE IF THE MEMORY MAP
+        // IS EITHER RW OR JUST RO
+
+        if(!MEM_BASE->WRITE) 
+        {
+            MEM_USAGE_INC(MEM_BASE, VIOLATION);
+            MEM_USAGE_INC(MEM_BASE, BUS_ERROR);
+            MEM_FAULT(BERR_READONLY, MEM_ERR_READONLY, MEM_WRITE);
+            MEM_FAULT_ERROR(MEM_ERR_READONLY, SIZE, "WRITE ATTEMPT TO READ-ONLY MEMORY AT 0x%0x, VIOLATION #%u", ADDRESS, MEM_BASE->USAGE->VIOLATION);
+            goto MALFORMED_WRITE;
+        }
+
+        uint32_t OFFSET = (ADDRESS - MEM_BASE->BASE);
+        uint32_t BYTES = SIZE / 8;
+
+        if((OFFSET + BYTES) > MEM_BASE->SIZE) 
+        {
+            MEM_USAGE_INC(MEM_BASE, VIOLATION);
+            MEM_USAGE_INC(MEM_BASE, BUS_ERROR);
+            MEM_BUS_FAULT(BERR_BOUNDS, MEM_ERR_BOUNDS, MEM_WRITE);
+            MEM_FAULT_ERROR(MEM_ERR_BOUNDS, SIZE, "WRITE OUT OF BOUNDS: OFFSET = %d, SIZE = %d, VIOLATION #%u", OFFSET, BYTES, MEM_BASE->USAGE->VIOLATION);
+            goto MALFORMED_WRITE;
+        }
+
+        // DETERMINE IF THE BERR PULSE LINE IS ENABLED FOR THIS BUFFER
+        if(MEM_BASE->BERR && BERR_LINE_ACTIVE())
+        {
+            MEM_USAGE_INC(MEM_BASE, BUS_ERROR);
+            MEM_FAULT(BERR_LINE_HELD, MEM_ERR_BERR, MEM_WRITE);
+            MEM_FAULT_ERROR(MEM_ERR_BERR, SIZE, "BERR ACTIVE FOR CURRENT BUFFER: %u", MEM_BASE->BUFFER);
+            goto MALFORMED_WRITE;
+        }
+
+        // FIRST WE READ AND DETERMINE THE WRITE STATISTICS OF THE CURRENT MEMORY MAP BEING ALLOCATED
         // THIS CHECK COMES AFTER WHICH WE DETERMINE THE SIZE OF THE MEMORY REGION AS THIS IS TO
-        // AVOID POTENTIAL SPILL-OVERS WITH ADDITIONAL READS
+        // AVOID POTENTIAL SPILL-OVERS WITH ADDITIONAL WRITES
+
+        MEM_USAGE_INC(MEM_BASE, WRITE_COUNT);
+        MEM_USAGE_SET(MEM_BASE, LAST_WRITE, ADDRESS);
+        MEM_USAGE_SET(MEM_BASE, ACCESSED, true);
+
+        uint8_t* MEM_PTR = MEM_BASE->BUFFER + OFFSET;
+        MEM_TRACE("[WRITE]", ADDRESS, SIZE, VALUE);
+
+        // THE PAGE IS ONLY MARKED ONCE THE STORE HAS LANDED - MARKED ANY EARLIER, A REHASH
+        // COULD CLEAR THE BIT AND HASH THE OLD BYTES, LEAVING THE PAGE STALE FOR GOOD
+
+        if(MEM_BASE->FLAGS & M68K_MAP_SHARED)
+        {
+            MEM_STORE_SHARED(MEM_PTR, SIZE, VALUE);
+            MEM_HASH_MARK(MEM_BASE, OFFSET, BYTES);
+            return;
+        }
+
+        switch (SIZE)
+        {
+            case MEM_SIZE_32:
+                *MEM_PTR++ = (VALUE >> 24) & M68K_LSB_MASK;
+                *MEM_PTR++ = (VALUE >> 16) & M68K_LSB_MASK;
+                *MEM_PTR++ = (VALUE >> 8) & M68K_LSB_MASK;
+                *MEM_PTR = VALUE & M68K_LSB_MASK;
+                break;
+
+            case MEM_SIZE_16:
+                *MEM_PTR++ = (VALUE >> 8) & M68K_LSB_MASK;
+                *MEM_PTR = VALUE & M68K_LSB_MASK;
+                break;
+            
+            case MEM_SIZE_8:
+                *MEM_PTR = VALUE & M68K_LSB_MASK;
+                break;
+        }
+
+        MEM_HASH_MARK(MEM_BASE, OFFSET, BYTES);
+        return;
+    }
+
+    MEM_BUS_FAULT(BERR_UNMAPPED_WRITE, MEM_ERR_UNMAPPED, MEM_WRITE);
+    MEM_FAULT_ERROR(MEM_ERR_UNMAPPED, SIZE, "NO BUFFER FOUND FOR ADDRESS: 0x%0X", ADDRESS);
+
+MALFORMED_WRITE:
+    MEM_FAULT_ERROR(MEM_ERR_BAD_WRITE, SIZE, "VALUE: 0x%0X, ADDRESS: 0x%0X", VALUE, ADDRESS);
+    MEM_TRACE("[INVALID WRITE]", ADDRESS, SIZE, VALUE);
+}
+
+static void MEMORY_WRITE(uint32_t ADDRESS, uint32_t SIZE, uint32_t VALUE)
+{
+    MEMORY_WRITE_REGION(MEM_FIND(ADDRESS), ADDRESS, SIZE, VALUE);
+}
+
+#if STATIC_MAP_HOOK == M68K_OPT_ON
+
+static uint32_t STATIC_MEMORY_READ(uint32_t ADDRESS, uint32_t SIZE)
+{
+    return MEMORY_READ_REGION(STATIC_MEM_FIND(ADDRESS), ADDRESS, SIZE);
+}
+
+static void STATIC_MEMORY_WRITE(uint32_t ADDRESS, uint32_t SIZE, uint32_t VALUE)
+{
+    MEMORY_WRITE_REGION(STATIC_MEM_FIND(ADDRESS), ADDRESS, SIZE, VALUE);
+}
+
+#endif
+
+// MEMORY MOVE OPERATIONS - HANDLES THE SPECIFICS BETWEEN SOURCE
+// AND DESTINATION OPERATIONS
+//
+// LOOKS TO FIND THE SOURCE AND DESTINATION OPERANDS TO PROPERLY
+// VALIDATE THEIR EXECUTION
+static void MEMORY_MOVE(uint32_t SRC, uint32_t DEST, uint32_t SIZE, uint32_t COUNT)
+{
+    VERBOSE_TRACE("MOVING %u BYTES FROM 0x%08X TO 0x%08X\n", COUNT, SRC, DEST);
+
+    // FIND BOTH OF THE CURRENT OPERANDS WITHIN THE OPERATION
+
+    M68K_MEM_BUFFER* SRC_BUFFER = BUS_FIND(SRC);
+    M68K_MEM_BUFFER* DEST_BUFFER = BUS_FIND(DEST);
+
+    if(SRC_BUFFER == NULL)
+    {
+        BERR_EVENT_PUSH(BERR_UNMAPPED_READ, MEM_ERR_UNMAPPED, SRC, SIZE, MEM_MOVE, false);
+        MEM_FAULT_ERROR(MEM_ERR_UNMAPPED, SIZE, "NO SOURCE BUFFER FOUND FOR ADDRESS: 0x%08X", SRC);
+        return;
+    }
+
+    if(DEST_BUFFER == NULL)
+    {
+        BERR_EVENT_PUSH(BERR_UNMAPPED_WRITE, MEM_ERR_UNMAPPED, DEST, SIZE, MEM_MOVE, false);
+        MEM_FAULT_ERROR(MEM_ERR_UNMAPPED, SIZE, "NO DESTINATION BUFFER FOUND FOR ADDRESS: 0x%08X", DEST);
+        return;
+    }
+
+    // CAN WE WRITE TO SAID DESTINATION?!
+    // ASSUME THAT WE HAVE THE PROPER CONDITIONS FOR THE HIGH BOUND OF THE EA
+    // THAT OF WHICH ENCOMPASSESS THE WRITE CONDITION
+
+    if(!DEST_BUFFER->WRITE)
+    {
+        MEM_USAGE_INC(DEST_BUFFER, VIOLATION);
+        MEM_ERROR(MEM_ERR_READONLY, SIZE, "MOVE ATTEMPT TO READ-ONLY MEMORY: 0x%08X, VIOLATION: #%u", DEST, DEST_BUFFER->USAGE->VIOLATION);
+    }
+
+    // GET THE ALL ENCOMPASSING SIZE OF THE OPERATION
+    uint32_t TRANSFER_SIZE = SIZE / 8;
+
+    // DETERMINE THE CONCURRENT BYTES IS REQUIRED PER EACH OPERATION
+    // SIZE IS ALL VARIABLE BASED ON THE DISTANCE BETWEEN INDIRECT AND EA
+    for(uint32_t INDEX = 0; INDEX < COUNT; INDEX += TRANSFER_SIZE)
+    {
+        uint32_t CURRENT_SRC = SRC + INDEX;
+        uint32_t CURRENT_DEST = DEST + INDEX;
+
+        // READ FROM THE CURRENT SORUCE AGAINST THE SIZE
+        // OF THE OPERATION
+        uint32_t SRC_READ = BUS_READ(CURRENT_SRC, SIZE);
+
+        // WRITE TO DESTINATION
+        BUS_WRITE(CURRENT_DEST, SIZE, SRC_READ);
+    }
+
+    MEM_USAGE_INC(SRC_BUFFER, MOVE_COUNT);
+    MEM_USAGE_SET(SRC_BUFFER, LAST_MOVE_SRC, SRC);
+    MEM_USAGE_INC(DEST_BUFFER, MOVE_COUNT);
+    MEM_USAGE_SET(DEST_BUFFER, LAST_MOVE_DEST, DEST);
+
+    MEM_MOVE_TRACE(SRC, DEST, SIZE, COUNT);
+} 
+
+/////////////////////////////////////////////////////
+//              REGION BACKING POLICY
+/////////////////////////////////////////////////////
+
+// REGIONS MAPPED WITH ANY OF THE M68K_MAP_BACKING FLAGS ARE BACKED BY THEIR OWN ANONYMOUS MAPPING
+// RATHER THAN THE HEAP, SO THAT THE PAGE SIZE, PREFAULTING AND PLACEMENT CAN BE CONTROLLED
+//
+// THE ORDER MATTERS - HUGE PAGES MUST BE ADVISED AND THE NODE BOUND BEFORE THE FIRST FAULT,
+// SO MAP_POPULATE IS ONLY PASSED WHEN THERE IS NOTHING TO DO BEFOREHAND. OTHERWISE THE PAGES
+// ARE PREFAULTED ONCE EVERYTHING ELSE IS IN PLACE
+
+#define         M68K_ALIGN_UP(SIZE, ALIGN) \
+                (((uint64_t)(SIZE) + (ALIGN) - 1) & ~(uint64_t)((ALIGN) - 1))
+
+#define         M68K_MPOL_PREFERRED             1
+#define         M68K_NUMA_MAX_NODES             1024
+
+// MADV_HUGEPAGE IS ACCEPTED EVEN WHEN THP IS DISABLED SYSTEM WIDE, SO IT'S
+// ONLY REPORTED AS IN EFFECT WHEN THE KERNEL IS GOING TO HONOUR IT
+
+static bool MEM_THP_AVAILABLE(void)
+{
+    static int AVAILABLE = -1;
+
+    if(AVAILABLE < 0)
+    {
+        char MODE[64] = {0};
+        FILE* HANDLE = fopen("/sys/kernel/mm/transparent_hugepage/enabled", "r");
+
+        AVAILABLE = (HANDLE != NULL) && fgets(MODE, sizeof(MODE), HANDLE) && (strstr(MODE, "[never]") == NULL);
+
+        if(HANDLE != NULL)
+            fclose(HANDLE);
+    }
+
+    return AVAILABLE;
+}
+
+// THE HUGE PAGES (IN KB) BACKING THE MAPPING WHICH HOLDS BASE - MADV_HUGEPAGE IS ONLY A HINT, AND EVEN
+// WITH THP ENABLED THE KERNEL IS FREE TO FALL BACK ON ORDINARY PAGES, SO THIS IS THE ONLY WAY OF KNOWING
+//
+// THE MAPPING MAY HAVE BEEN MERGED WITH A NEIGHBOUR, IN WHICH CASE IT'S HUGE PAGES ARE COUNTED TOO
+
+static unsigned long MEM_THP_RESIDENT(const uint8_t* BASE)
+{
+    FILE* HANDLE = fopen("/proc/self/smaps", "r");
+    char LINE[512];
+    bool WITHIN = false;
+    unsigned long START = 0, END = 0, KB = 0;
+
+    if(HANDLE == NULL)
+        return 0;
+
+    while(fgets(LINE, sizeof(LINE), HANDLE))
+    {
+        if(sscanf(LINE, "%lx-%lx ", &START, &END) == 2)
+            WITHIN = (uintptr_t)BASE >= START && (uintptr_t)BASE < END;
+
+        else if(WITHIN && sscanf(LINE, "AnonHugePages: %lu kB", &KB) == 1)
+            break;
+    }
+
+    fclose(HANDLE);
+    return WITHIN ? KB : 0;
+}
+
+// MAP LENGTH BYTES STARTING ON AN ALIGN BOUNDARY - MMAP ONLY GUARANTEES PAGE ALIGNMENT,
+// SO FOR HUGE PAGES THE MAPPING IS OVER-ALLOCATED AND THE EXCESS EITHER SIDE TRIMMED
+
+static uint8_t* MEM_BACKING_MAP(size_t LENGTH, size_t ALIGN, int EXTRA)
+{
+    size_t SPAN = LENGTH + ALIGN;
+    uint8_t* BASE = mmap(NULL, SPAN, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | EXTRA, -1, 0);
+
+    if(BASE == MAP_FAILED)
+        return NULL;
+
+    if(ALIGN == 0)
+        return BASE;
+
+    uint8_t* START = (uint8_t*)M68K_ALIGN_UP((uintptr_t)BASE, ALIGN);
+
+    if(START > BASE)
+        munmap(BASE, START - BASE);
+
+    if(BASE + SPAN > START + LENGTH)
+        munmap(START + LENGTH, (BASE + SPAN) - (START + LENGTH));
+
+    return START;
+}
+
+// PREFER THE NODE OF THE CPU THE CALLING THREAD IS RUNNING ON - THE MAPPING SHOULD THEREFORE BE
+// MADE FROM THE THREAD WHICH OWNS THE BUS. PREFERRED RATHER THAN BOUND, SO A FULL NODE SPILLS OVER
+
+static int MEM_BACKING_BIND(uint8_t* BASE, size_t LENGTH)
+{
+#if defined(SYS_getcpu) && defined(SYS_mbind)
+    unsigned CPU = 0;
+    unsigned NODE = 0;
+    unsigned long MASK[M68K_NUMA_MAX_NODES / (8 * sizeof(unsigned long))] = {0};
+
+    if(syscall(SYS_getcpu, &CPU, &NODE, NULL) != 0 || NODE >= M68K_NUMA_MAX_NODES)
+        return -1;
+
+    MASK[NODE / (8 * sizeof(unsigned long))] |= 1UL << (NODE % (8 * sizeof(unsigned long)));
+
+    if(syscall(SYS_mbind, BASE, LENGTH, M68K_MPOL_PREFERRED, MASK, (unsigned long)M68K_NUMA_MAX_NODES + 1, 0) != 0)
+        return -1;
+
+    return (int)NODE;
+#else
+    (void)BASE;
+    (void)LENGTH;
+    return -1;
+#endif
+}
+
+static void MEM_BACKING_POPULATE(uint8_t* BASE, size_t LENGTH)
+{
+#ifdef MADV_POPULATE_WRITE
+    if(madvise(BASE, LENGTH, MADV_POPULATE_WRITE) == 0)
+        return;
+#endif
+
+    for(size_t OFFSET = 0; OFFSET < LENGTH; OFFSET += M68K_PAGE_SIZE)
+    {
+        ((volatile uint8_t*)BASE)[OFFSET] = 0;
+    }
+}
+
+// EXPLICIT HUGE PAGES COME FROM THE RESERVED POOL (VM.NR_HUGEPAGES) WHICH MAY WELL BE EMPTY
+// SO SHOULD THAT FAIL, THE REGION FALLS BACK ON TRANSPARENT HUGE PAGES AND THEN ORDINARY PAGES
+//
+// BUF->BACKING RECORDS WHICH OF THE REQUESTED POLICIES ACTUALLY TOOK EFFECT - TRANSPARENT HUGE PAGES
+// ARE ONLY RECORDED AS SUCH ONCE THEY'RE SEEN BACKING THE PREFAULTED REGION, AND AS ADVISED UNTIL THEN
+
+static bool MEMORY_BACKING_ALLOC(M68K_MEM_BUFFER* BUF)
+{
+    uint32_t FLAGS = BUF->FLAGS;
+    bool HUGE = (FLAGS & (M68K_MAP_THP | M68K_MAP_HUGETLB)) != 0;
+    size_t LENGTH = M68K_ALIGN_UP(BUF->SIZE, HUGE ? M68K_HUGE_PAGE_SIZE : M68K_PAGE_SIZE);
+    int POPULATE = ((FLAGS & M68K_MAP_POPULATE) && !(FLAGS & M68K_MAP_NUMA_LOCAL)) ? MAP_POPULATE : 0;
+    uint8_t* BASE = NULL;
+
+    BUF->BACKING = M68K_BACKING_HEAP;
+    BUF->NODE = -1;
+
+#ifdef MAP_HUGETLB
+    if(FLAGS & M68K_MAP_HUGETLB)
+    {
+        BASE = mmap(NULL, LENGTH, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB | POPULATE, -1, 0);
+
+        if(BASE == MAP_FAILED)
+            BASE = NULL;
+        else
+            BUF->BACKING |= M68K_BACKING_HUGETLB;
+    }
+#endif
+
+    if(BASE == NULL)
+    {
+        if(HUGE)
+            POPULATE = 0;
+
+        BASE = MEM_BACKING_MAP(LENGTH, HUGE ? M68K_HUGE_PAGE_SIZE : 0, POPULATE);
+
+        if(BASE == NULL)
+            return false;
+
+        BUF->BACKING |= M68K_BACKING_ANON;
+
+#ifdef MADV_HUGEPAGE
+        if(HUGE && madvise(BASE, LENGTH, MADV_HUGEPAGE) == 0 && MEM_THP_AVAILABLE())
+            BUF->BACKING |= M68K_BACKING_THP_ADVISED;
+#endif
+    }
+
+    if(FLAGS & M68K_MAP_NUMA_LOCAL)
+    {
+        BUF->NODE = MEM_BACKING_BIND(BASE, LENGTH);
+
+        if(BUF->NODE >= 0)
+            BUF->BACKING |= M68K_BACKING_NUMA;
+    }
+
+    if((FLAGS & M68K_MAP_POPULATE) && !POPULATE)
+        MEM_BACKING_POPULATE(BASE, LENGTH);
+
+    if(FLAGS & M68K_MAP_POPULATE)
+        BUF->BACKING |= M68K_BACKING_POPULATED;
+
+    if((BUF->BACKING & M68K_BACKING_THP_ADVISED) && (FLAGS & M68K_MAP_POPULATE) && MEM_THP_RESIDENT(BASE) > 0)
+        BUF->BACKING |= M68K_BACKING_THP;
+
+    BUF->BUFFER = BASE;
+    BUF->BACKING_SIZE = (uint32_t)LENGTH;
+    return true;
+}
+
+// RELEASE A REGION'S BACKING, WHEREVER IT CAME FROM - EXPORTED REGIONS ARE
+// RELEASED ALONGSIDE THE EXPORT AND STATIC REGIONS ARE NEVER RELEASED
+
+static void MEMORY_BACKING_FREE(M68K_MEM_BUFFER* BUF)
+{
+    if(BUF->BACKING & (M68K_BACKING_ANON | M68K_BACKING_HUGETLB))
+        munmap(BUF->BUFFER, BUF->BACKING_SIZE);
+
+    else if(!(BUF->BACKING & (M68K_BACKING_SHM | M68K_BACKING_STATIC)))
+        free(BUF->BUFFER);
+
+    BUF->BUFFER = NULL;
+}
+
+/////////////////////////////////////////////////////
+//              SHARED MEMORY EXPORT
+/////////////////////////////////////////////////////
+
+// REGIONS MAPPED WITH M68K_MAP_EXPORT ARE BACKED BY A SINGLE NAMED POSIX SHARED MEMORY OBJECT
+// (SEE MEM_EXPORT.H) SO THAT ANY LOCAL PROCESS CAN MAP GUEST RAM READ-ONLY AND INSPECT IT LIVE
+//
+// THE OBJECT IS SIZED FOR THE WHOLE ADDRESSABLE SPACE UP FRONT - IT'S SPARSE, SO ONLY
+// THE PAGES A REGION ACTUALLY TOUCHES ARE EVER ALLOCATED
+
+#define         M68K_EXPORT_ALIGN(SIZE) \
+                (((uint64_t)(SIZE) + M68K_EXPORT_PAGE_SIZE - 1) & ~(uint64_t)(M68K_EXPORT_PAGE_SIZE - 1))
+
+typedef char EXPORT_CHECK_REGIONS[(M68K_MAX_BUFFERS <= M68K_EXPORT_MAX_REGIONS) ? 1 : -1];
+
+static M68K_EXPORT_HEADER* MEM_EXPORT = NULL;
+static int MEM_EXPORT_FD = -1;
+static uint64_t MEM_EXPORT_NEXT = 0;
+
+static bool MEMORY_EXPORT_OPEN(void)
+{
+    if(MEM_EXPORT != NULL)
+        return true;
+
+    uint64_t HEADER_SIZE = M68K_EXPORT_ALIGN(sizeof(M68K_EXPORT_HEADER));
+    uint64_t TOTAL_SIZE = HEADER_SIZE + M68K_MAX_MEMORY_SIZE + (M68K_EXPORT_MAX_REGIONS * M68K_EXPORT_PAGE_SIZE);
+
+    // THE OBJECT IS ONLY EVER CREATED, NEVER ADOPTED - TRUNCATING ONE LEFT BEHIND BY ANOTHER
+    // INSTANCE WOULD PULL IT'S GUEST RAM OUT FROM UNDER IT (AND UNDER ANYONE READING IT)
+
+    int FD = shm_open(M68K_EXPORT_NAME, O_CREAT | O_EXCL | O_RDWR, 0644);
+
+    if(FD < 0)
+    {
+        if(errno == EEXIST)
+            MEM_ERROR(MEM_ERR_EXPORT, 0, "%s IS ALREADY IN USE - REMOVE /dev/shm%s IF IT'S STALE, OR BUILD WITH ANOTHER M68K_EXPORT_NAME",
+                M68K_EXPORT_NAME, M68K_EXPORT_NAME);
+
+        return false;
+    }
+
+    if(ftruncate(FD, (off_t)TOTAL_SIZE) != 0)
+        goto EXPORT_FAILED;
+
+    void* BASE = mmap(NULL, TOTAL_SIZE, PROT_READ | PROT_WRITE, MAP_SHARED, FD, 0);
+
+    if(BASE == MAP_FAILED)
+        goto EXPORT_FAILED;
+
+    MEM_EXPORT = BASE;
+    MEM_EXPORT_FD = FD;
+    MEM_EXPORT_NEXT = HEADER_SIZE;
+
+    MEM_EXPORT->HEADER_SIZE = (uint32_t)HEADER_SIZE;
+    MEM_EXPORT->TOTAL_SIZE = TOTAL_SIZE;
+    MEM_EXPORT->VERSION = M68K_EXPORT_VERSION;
+    MEM_EXPORT->REGION_COUNT = 0;
+    __atomic_store_n(&MEM_EXPORT->MAGIC, M68K_EXPORT_MAGIC, __ATOMIC_RELEASE);
+    return true;
+
+EXPORT_FAILED:
+    close(FD);
+    shm_unlink(M68K_EXPORT_NAME);
+    return false;
+}
+
+// CARVE THE NEXT PAGE ALIGNED SLICE OF THE OBJECT OUT FOR A REGION, AND POINT
+// IT'S USAGE COUNTERS AT IT'S ENTRY WITHIN THE HEADER
+
+static bool MEMORY_EXPORT_REGION(M68K_MEM_BUFFER* BUF)
+{
+    if(!MEMORY_EXPORT_OPEN())
+        return false;
+
+    uint32_t INDEX = MEM_EXPORT->REGION_COUNT;
+
+    if(INDEX >= M68K_EXPORT_MAX_REGIONS)
+        return false;
+
+    M68K_EXPORT_REGION* REGION = &MEM_EXPORT->REGIONS[INDEX];
+    REGION->BASE = BUF->BASE;
+    REGION->END = BUF->END;
+    REGION->SIZE = BUF->SIZE;
+    REGION->FLAGS = (BUF->WRITE ? M68K_EXPORT_RW : 0) | (BUF->BERR ? M68K_EXPORT_BERR : 0);
+    REGION->DATA_OFFSET = MEM_EXPORT_NEXT;
+
+    MEM_EXPORT_NEXT += M68K_EXPORT_ALIGN(BUF->SIZE);
+
+    BUF->BUFFER = (uint8_t*)MEM_EXPORT + REGION->DATA_OFFSET;
+    BUF->BACKING = M68K_BACKING_SHM;
+    BUF->USAGE = &REGION->USAGE;
+
+    __atomic_store_n(&MEM_EXPORT->REGION_COUNT, INDEX + 1, __ATOMIC_RELEASE);
+    return true;
+}
+
+// TEAR DOWN THE EXPORT - ONLY ONCE THE BUS IS FINISHED WITH, AS EVERY
+// EXPORTED REGION'S BUFFER LIVES WITHIN THE OBJECT
+
+void MEMORY_EXPORT_CLOSE(void)
+{
+    if(MEM_EXPORT == NULL)
+        return;
+
+    munmap(MEM_EXPORT, MEM_EXPORT->TOTAL_SIZE);
+    close(MEM_EXPORT_FD);
+    shm_unlink(M68K_EXPORT_NAME);
+
+    MEM_EXPORT = NULL;
+    MEM_EXPORT_FD = -1;
+    MEM_EXPORT_NEXT = 0;
+}
+
+// EXTENDED MEMORY MAP WHICH ALLOWS FOR THE BACKING OF A REGION TO BE DETERMINED
+// THROUGH THE M68K_MAP_* FLAGS (SHARED WITH A DEVICE THREAD, ETC)
+
+void MEMORY_MAP_EX(uint32_t BASE, uint32_t END, bool WRITABLE, bool ENABLE_BERR, uint32_t FLAGS) 
+{
+    uint32_t SIZE = (END - BASE) + 1;
+    uint32_t MAPPED = SIZE;
+
+#if STATIC_MAP_HOOK == M68K_OPT_ON
+    // THE GENERATED DECODER NEVER LOOKS AT MEM_BUFFERS, SO NOTHING WOULD EVER BE ROUTED TO THE REGION
+    MEM_ERROR(MEM_ERR_UNMAPPED, SIZE, "CANNOT MAP 0x%08X - 0x%08X - THE BUS IS DECODED BY THE STATIC MAP", BASE, END);
+    return;
+#endif
+
+    if(MEM_NUM_BUFFERS >= M68K_MAX_BUFFERS) 
+    {
+        MEM_ERROR(MEM_ERR_BUFFER, SIZE, "CANNOT MAP - TOO MANY BUFFERS %s", " ");
+        return;
+    }
+
+    // DETERMINES WHETHER OR NOT THE MAX SIZE HAS BEEN EXCEEDED 
+    // FOR ONLY A SINGULAR BUFFER
+    if(END > M68K_MAX_ADDR_END)
+    {
+        MEM_ERROR(MEM_ERR_BUS, (uint32_t)SIZE, "END ADDRESS 0x%08X EXCEEDS THE BUS LIMIT: (0x%08X - %d%s)", 
+                  END, M68K_MAX_ADDR_END, FORMAT_SIZE(M68K_MAX_MEMORY_SIZE), FORMAT_UNIT(M68K_MAX_MEMORY_SIZE));
+        return;
+    }
+
+    // CALCULATE THE TOTAL MAPPED SIZE ACROSS ALL CONCURRENT BUFFERS
+    // THIS PREVENTS POTENTIAL BUFFER OVERFLOWS WHEREBY 
+    // CONJOINED BUFFERS WERE TO EXCEED THE MAX
+
+    for(unsigned INDEX = 0; INDEX < MEM_NUM_BUFFERS; INDEX++)
+    {
+        MAPPED += MEM_BUFFERS[INDEX].SIZE;
+    }
+
+    if(MAPPED > M68K_MAX_MEMORY_SIZE)
+    {
+        MEM_ERROR(MEM_ERR_BOUNDS, SIZE, "TOTAL MAPPED SIZE: (%d%s) EXCEEDS THE BUS LIMIT", 
+            FORMAT_SIZE(MAPPED), FORMAT_UNIT(MAPPED));
+            return;
+    }
+
+    // DEFINE AND INITIALISE BUFFER-RELATED PARAMS
+    // ONLY ALLOCATE HOW MANY BUFFERS WE NEED BASED ON THE MAX
+    M68K_MEM_BUFFER* BUF = &MEM_BUFFERS[MEM_NUM_BUFFERS++];
+    BUF->BASE = BASE;
+    BUF->END = END;
+    BUF->SIZE = SIZE;
+    BUF->WRITE = WRITABLE;
+    BUF->BERR = ENABLE_BERR;
+    BUF->FLAGS = FLAGS;
+    BUF->BACKING = M68K_BACKING_HEAP;
+    BUF->NODE = -1;
+    BUF->USAGE = &MEM_USAGE[MEM_NUM_BUFFERS - 1];
+    BUF->BUFFER = NULL;
+
+    // EXPORTED REGIONS FALL BACK TO PRIVATE MEMORY SHOULD THE OBJECT BE UNAVAILABLE
+
+    if((FLAGS & M68K_MAP_EXPORT) && !MEMORY_EXPORT_REGION(BUF))
+    {
+        MEM_ERROR(MEM_ERR_EXPORT, SIZE, "REGION 0x%08X - 0x%08X FALLS BACK TO PRIVATE MEMORY", BASE, END);
+        BUF->FLAGS &= ~M68K_MAP_EXPORT;
+    }
+
+    // AS WILL REGIONS WHOSE BACKING POLICY COULDN'T BE APPLIED AT ALL
+
+    if(BUF->BUFFER == NULL && (FLAGS & M68K_MAP_BACKING) && !MEMORY_BACKING_ALLOC(BUF))
+    {
+        MEM_ERROR(MEM_ERR_BACKING, SIZE, "REGION 0x%08X - 0x%08X FALLS BACK TO THE HEAP", BASE, END);
+    }
+
+    if(BUF->BUFFER == NULL)
+    {
+        BUF->BUFFER = malloc(SIZE);
+        memset(BUF->BUFFER, 0, SIZE);
+    }
+
+    // DETERMINE WHICH MEMORY MAPS ARE BEING USED AT ANY GIVEN TIME
+    // FOR NOW, WE ARE ONLY CONCERNED WITH THE RAM AND IO TO COMMUNICATE
+    // WITH THE 68K'S BUS
+
+    memset(BUF->USAGE, 0, sizeof(M68K_MEM_USAGE));
+    BUF->USAGE->ACCESSED = false;
+
+    // WHICHEVER THREAD BUILDS THE BUS IS TAKEN TO BE THE 68K SIDE
+    BERR_CLAIM();
+
+    MEM_MAP_TRACE(MEM_MAP, BUF->BASE, BUF->END, BUF->SIZE, BUF->BUFFER);
+}
+
+void MEMORY_MAP(uint32_t BASE, uint32_t END, bool WRITABLE, bool ENABLE_BERR) 
+{
+    MEMORY_MAP_EX(BASE, END, WRITABLE, ENABLE_BERR, M68K_MAP_DEFAULT_FLAGS);
+}
+
+// TEAR DOWN EVERY DYNAMIC REGION, RETURNING THE BUS TO IT'S POWER ON STATE
+// THE EXPORT IS CLOSED ALONGSIDE, AS THE SLICES OF THE OBJECT ARE NEVER REUSED
+//
+// THE LATENCY HISTOGRAMS ARE KEYED BY SLOT, SO THEY ARE CLEARED TOO - OTHERWISE A REMAP WOULD
+// MERGE IT'S SAMPLES INTO THOSE OF WHICHEVER REGION HELD THE SLOT BEFORE
+
+void MEMORY_UNMAP_ALL(void)
+{
+    for(unsigned INDEX = 0; INDEX < MEM_NUM_BUFFERS; INDEX++)
+    {
+        M68K_MEM_BUFFER* BUF = &MEM_BUFFERS[INDEX];
+
+        MEM_MAP_TRACE(MEM_UNMAP, BUF->BASE, BUF->END, BUF->SIZE, BUF->BUFFER);
+
+        MEMORY_BACKING_FREE(BUF);
+        MEMORY_HASH_FREE(&BUF->HASH);
+        memset(BUF, 0, sizeof(*BUF));
+    }
+
+    MEM_NUM_BUFFERS = 0;
+    MEMORY_EXPORT_CLOSE();
+
+    memset(&BERR_STATE, 0, sizeof(BERR_STATE));
+    BERR_QUEUE_RESET();
+    M68K_STOPPED = 0;
+
+#if LATENCY_HOOK == M68K_OPT_ON
+    memset(MEM_LATENCY, 0, sizeof(MEM_LATENCY));
+#endif
+}
+
+#if STATIC_MAP_HOOK == M68K_OPT_ON
+
+// CROSS-CHECK THE GENERATED DECODER AGAINST MEM_FIND - THE STATIC DESCRIPTORS ARE BRIEFLY ALIASED
+// INTO MEM_BUFFERS (SHARING THEIR STORAGE, SO NOTHING IS ALLOCATED) AND EVERY PROBE AROUND THE EDGES
+// OF EACH REGION IS RUN THROUGH BOTH PATHS, AT EVERY SIZE, AS BOTH A READ AND A WRITE
+//
+// EACH PROBE MUST RETURN THE SAME VALUE, RAISE THE SAME FAULT EVENTS, LEAVE THE SAME BERR STATE AND
+// MOVE THE SAME USAGE COUNTERS. WRITES STORE BACK WHAT WAS ALREADY THERE, AND THE COUNTERS AND
+// BERR STATE ARE PUT BACK AFTERWARDS, SO THE CHECK LEAVES THE BUS AS IT FOUND IT
+
+#define STATIC_REGION_PROBES(NAME, LOW, HIGH, RW, ERR, MAP) \
+    (LOW) - 1, (LOW), (LOW) + 1, (HIGH) - 3, (HIGH) - 2, (HIGH) - 1, (HIGH), (HIGH) + 1,
+
+static uint64_t STATIC_MAP_PROBE(bool STATIC, bool WRITE, uint32_t ADDRESS, uint32_t SIZE)
+{
+    M68K_BERR_EVENT EVENT;
+    uint32_t VALUE = STATIC ? STATIC_MEMORY_READ(ADDRESS, SIZE) : MEMORY_READ(ADDRESS, SIZE);
+
+    if(WRITE)
+        STATIC ? STATIC_MEMORY_WRITE(ADDRESS, SIZE, VALUE) : MEMORY_WRITE(ADDRESS, SIZE, VALUE);
+
+    uint64_t RESULT = ((uint64_t)VALUE << 32) | ((uint32_t)BERR_STATE.TYPE << 8) |
+                      ((uint32_t)BERR_STATE.ACTIVE << 2) | ((uint32_t)BERR_STATE.DOUBLE_FAULT << 1) | (M68K_STOPPED != 0);
+
+    while(BERR_QUEUE_DRAIN(&EVENT, 1))
+    {
+        RESULT = MEM_HASH_COMBINE(RESULT, ((uint64_t)EVENT.ADDRESS << 32) | ((uint32_t)EVENT.TYPE << 24) |
+                    ((uint32_t)EVENT.ERROR << 16) | ((uint32_t)(uint8_t)EVENT.OP << 8) | EVENT.SIZE);
+    }
+
+    return RESULT;
+}
+
+bool STATIC_MAP_CROSS_CHECK(void)
+{
+    static const uint32_t PROBES[] = { M68K_STATIC_MEMORY_MAP(STATIC_REGION_PROBES) M68K_MAX_ADDR_END };
+    static const uint32_t SIZES[] = { MEM_SIZE_8, MEM_SIZE_16, MEM_SIZE_32 };
+
+    M68K_MEM_BUFFER SAVED_BUFFERS[M68K_MAX_BUFFERS];
+    M68K_MEM_USAGE SAVED_USAGE[STATIC_NUM_REGIONS];
+    M68K_MEM_USAGE STATIC_SEEN[STATIC_NUM_REGIONS];
+    M68K_BERR_STATE SAVED_BERR = BERR_STATE;
+    M68K_BERR_QUEUE* SAVED_QUEUE = malloc(sizeof(M68K_BERR_QUEUE));
+
+    unsigned SAVED_COUNT = MEM_NUM_BUFFERS;
+    unsigned SAVED_STOPPED = M68K_STOPPED;
+    unsigned SAVED_T0 = M68K_T0, SAVED_T1 = M68K_T1;
+    unsigned MISMATCHES = 0;
+
+    if(SAVED_QUEUE == NULL)
+        return false;
+
+    *SAVED_QUEUE = BERR_QUEUE;
+    memcpy(SAVED_BUFFERS, MEM_BUFFERS, sizeof(MEM_BUFFERS));
+    memcpy(SAVED_USAGE, STATIC_USAGE, sizeof(STATIC_USAGE));
+    memcpy(MEM_BUFFERS, STATIC_BUFFERS, sizeof(STATIC_BUFFERS));
+    MEM_NUM_BUFFERS = STATIC_NUM_REGIONS;
+
+    // EVERY PROBE WOULD OTHERWISE BE TRACED TWICE
+    SET_TRACE_FLAGS(0, 0);
+
+    for(unsigned PROBE = 0; PROBE < sizeof(PROBES) / sizeof(PROBES[0]); PROBE++)
+    {
+        for(unsigned SIZE = 0; SIZE < sizeof(SIZES) / sizeof(SIZES[0]); SIZE++)
+        {
+            for(unsigned WRITE = 0; WRITE < 2; WRITE++)
+            {
+                BERR_ACKNOWLEDGE();
+                BERR_QUEUE_RESET();
+
+                M68K_BERR_STATE BEFORE = BERR_STATE;
+                uint64_t STATIC = STATIC_MAP_PROBE(true, WRITE, PROBES[PROBE], SIZES[SIZE]);
+                memcpy(STATIC_SEEN, STATIC_USAGE, sizeof(STATIC_USAGE));
+
+                BERR_STATE = BEFORE;
+                M68K_STOPPED = 0;
+                memcpy(STATIC_USAGE, SAVED_USAGE, sizeof(STATIC_USAGE));
+
+                uint64_t DYNAMIC = STATIC_MAP_PROBE(false, WRITE, PROBES[PROBE], SIZES[SIZE]);
+
+                if(STATIC != DYNAMIC || memcmp(STATIC_SEEN, STATIC_USAGE, sizeof(STATIC_USAGE)) != 0)
+                {
+                    printf("[STATIC] %s.%u AT 0x%08X: DECODERS DISAGREE (STATIC 0x%016llX, DYNAMIC 0x%016llX%s)\n",
+                            WRITE ? "WRITE" : "READ", SIZES[SIZE], PROBES[PROBE], 
+                            (unsigned long long)STATIC, (unsigned long long)DYNAMIC,
+                            (STATIC == DYNAMIC) ? ", USAGE COUNTERS DIFFER" : "");
+                    MISMATCHES++;
+                }
+
+                memcpy(STATIC_USAGE, SAVED_USAGE, sizeof(STATIC_USAGE));
+            }
+        }
+    }
+
+    SET_TRACE_FLAGS(SAVED_T0, SAVED_T1);
+
+    memcpy(MEM_BUFFERS, SAVED_BUFFERS, sizeof(MEM_BUFFERS));
+    MEM_NUM_BUFFERS = SAVED_COUNT;
+    BERR_STATE = SAVED_BERR;
+    BERR_QUEUE = *SAVED_QUEUE;
+    M68K_STOPPED = SAVED_STOPPED;
+    free(SAVED_QUEUE);
+
+    return MISMATCHES == 0;
+}
+
+#endif
+
+/////////////////////////////////////////////////////
+//          ATOMIC READ-MODIFY-WRITE BUS
+/////////////////////////////////////////////////////
+
+// TAS AND CAS ASSERT AN INDIVISIBLE READ-MODIFY-WRITE CYCLE ON THE 68K'S BUS
+// SO THAT NO OTHER BUS MASTER CAN EVER OBSERVE THE READ AND WRITE HALVES SEPARATELY
+//
+// VALIDATION IS THE SAME AS MEMORY_WRITE - AN OPERAND THE HOST CAN'T SWAP IN A SINGLE
+// INSTRUCTION IS HANDED TO THE SERIALISED PATH BY MEM_CAS_SHARED RATHER THAN REJECTED
+
+static uint8_t* MEMORY_RMW_FIND(uint32_t ADDRESS, uint32_t SIZE, M68K_MEM_BUFFER** MEM_OUT)
+{
+    M68K_MEM_BUFFER* MEM_BASE = BUS_FIND(ADDRESS);
+
+    VERBOSE_TRACE("ATTEMPTING LOCKED ACCESS TO ADDRESS: 0x%X (SIZE = %d)\n", ADDRESS, SIZE);
+
+    // CHECK FOR POSSIBLE ALIGNMENT ISSUES WITHIN THE BUS HANDLER
+    if(!M68K_BUS_ALIGNMENT(ADDRESS, SIZE))
+    {
+        MEM_FAULT(BERR_ALIGN, MEM_ERR_ALIGN, MEM_RMW);
+        MEM_FAULT_ERROR(MEM_ERR_ALIGN, SIZE, "MISALIGNED ADDRESS AT: 0x%08X", ADDRESS);
+        goto MALFORMED_RMW;
+    }
+
+    // BOUND CHECKS FOR INVALID ADDRESSING
+    if(ADDRESS > M68K_MAX_ADDR_END || ADDRESS > M68K_MAX_MEMORY_SIZE)
+    {
+        MEM_FAULT(BERR_BOUNDS, MEM_ERR_RESERVED, MEM_RMW);
+        MEM_FAULT_ERROR(MEM_ERR_RESERVED, SIZE, "ATTEMPT TO LOCK A RESERVED ADDRESS RANGE: 0x%X", ADDRESS);
+        MEM_FAULT_ERROR(MEM_ERR_BOUNDS, SIZE, "ATTEMPT TO LOCK AN ADDRESS RANGE BEYOND THE ADDRESSABLE SPACE: 0x%X", ADDRESS);
+        goto MALFORMED_RMW;
+    }
+
+    if(MEM_BASE == NULL)
+    {
+        MEM_BUS_FAULT(BERR_UNMAPPED_WRITE, MEM_ERR_UNMAPPED, MEM_RMW);
+        MEM_FAULT_ERROR(MEM_ERR_UNMAPPED, SIZE, "NO BUFFER FOUND FOR ADDRESS: 0x%0X", ADDRESS);
+        goto MALFORMED_RMW;
+    }
+
+    if(!MEM_BASE->WRITE) 
+    {
+        MEM_USAGE_INC(MEM_BASE, VIOLATION);
+        MEM_USAGE_INC(MEM_BASE, BUS_ERROR);
+        MEM_FAULT(BERR_READONLY, MEM_ERR_READONLY, MEM_RMW);
+        MEM_FAULT_ERROR(MEM_ERR_READONLY, SIZE, "LOCKED ACCESS TO READ-ONLY MEMORY AT 0x%0x, VIOLATION #%u", ADDRESS, MEM_BASE->USAGE->VIOLATION);
+        goto MALFORMED_RMW;
+    }
+
+    uint32_t OFFSET = (ADDRESS - MEM_BASE->BASE);
+    uint32_t BYTES = SIZE / 8;
+
+    // THE WHOLE OPERAND MUST LIE WITHIN THE BUFFER, AS THE HOST
+    // IS GOING TO TOUCH IT IN A SINGLE INSTRUCTION
+    if((OFFSET + BYTES) > MEM_BASE->SIZE) 
+    {
+        MEM_USAGE_INC(MEM_BASE, VIOLATION);
+        MEM_USAGE_INC(MEM_BASE, BUS_ERROR);
+        MEM_BUS_FAULT(BERR_BOUNDS, MEM_ERR_BOUNDS, MEM_RMW);
+        MEM_FAULT_ERROR(MEM_ERR_BOUNDS, SIZE, "LOCKED ACCESS OUT OF BOUNDS: OFFSET = %d, SIZE = %d, VIOLATION #%u", OFFSET, BYTES, MEM_BASE->USAGE->VIOLATION);
+        goto MALFORMED_RMW;
+    }
+
+    uint8_t* MEM_PTR = MEM_BASE->BUFFER + OFFSET;
+
+    // DETERMINE IF THE BERR PULSE LINE IS ENABLED FOR THIS BUFFER
+    if(MEM_BASE->BERR && BERR_LINE_ACTIVE())
+    {
+        MEM_USAGE_INC(MEM_BASE, BUS_ERROR);
+        MEM_FAULT(BERR_LINE_HELD, MEM_ERR_BERR, MEM_RMW);
+        MEM_FAULT_ERROR(MEM_ERR_BERR, SIZE, "BERR ACTIVE FOR CURRENT BUFFER: 0x%08X", MEM_BASE->BASE);
+        goto MALFORMED_RMW;
+    }
+
+    // A LOCKED CYCLE IS BOTH A READ AND A WRITE ON THE BUS
+
+    MEM_USAGE_INC(MEM_BASE, READ_COUNT);
+    MEM_USAGE_INC(MEM_BASE, WRITE_COUNT);
+    MEM_USAGE_SET(MEM_BASE, LAST_READ, ADDRESS);
+    MEM_USAGE_SET(MEM_BASE, LAST_WRITE, ADDRESS);
+    MEM_USAGE_SET(MEM_BASE, ACCESSED, true);
+
+    if(MEM_OUT != NULL) *MEM_OUT = MEM_BASE;
+    return MEM_PTR;
+
+MALFORMED_RMW:
+    MEM_FAULT_ERROR(MEM_ERR_BAD_WRITE, SIZE, "LOCKED ACCESS AT ADDRESS: 0x%0X", ADDRESS);
+    MEM_TRACE("[INVALID RMW]", ADDRESS, SIZE, ~(uint32_t)0);
+    return NULL;
+}
+
+// TEST AND SET - RETURNS THE ORIGINAL BYTE (FROM WHICH N AND Z ARE DERIVED)
+// AND SETS BIT 7 OF THE OPERAND IN THE SAME LOCKED CYCLE
+
+static uint32_t MEMORY_TAS(uint32_t ADDRESS)
+{
+    M68K_MEM_BUFFER* MEM_BASE = NULL;
+    uint8_t* MEM_PTR = MEMORY_RMW_FIND(ADDRESS, MEM_SIZE_8, &MEM_BASE);
+
+    if(MEM_PTR == NULL)
+        return 0;
+
+    uint32_t MEM_RETURN = __atomic_fetch_or(MEM_PTR, 0x80, __ATOMIC_SEQ_CST);
+    MEM_HASH_MARK(MEM_BASE, MEM_PTR - MEM_BASE->BUFFER, 1);
+    MEM_TRACE("[TAS]", ADDRESS, MEM_SIZE_8, MEM_RETURN);
+    return MEM_RETURN;
+}
+
+// COMPARE AND SWAP - IF THE OPERAND MATCHES COMPARE, UPDATE IS WRITTEN
+// OTHERWISE COMPARE IS LOADED WITH THE OPERAND (AS CAS DOES WITH Dc)
+//
+// A FAILED COMPARE ALWAYS LEAVES A DIFFERENT VALUE IN COMPARE, WHEREAS A FAULTING
+// ACCESS RETURNS FALSE WITH COMPARE UNTOUCHED - WHICH IS HOW THE TWO ARE TOLD APART
+
+static bool MEMORY_CAS(uint32_t ADDRESS, uint32_t SIZE, uint32_t* COMPARE, uint32_t UPDATE)
+{
+    M68K_MEM_BUFFER* MEM_BASE = NULL;
+    uint8_t* MEM_PTR = MEMORY_RMW_FIND(ADDRESS, SIZE, &MEM_BASE);
+
+    if(MEM_PTR == NULL)
+        return false;
+
+    bool RESULT = MEM_CAS_SHARED(MEM_PTR, SIZE, COMPARE, UPDATE);
+
+    if(RESULT)
+        MEM_HASH_MARK(MEM_BASE, MEM_PTR - MEM_BASE->BUFFER, SIZE / 8);
+
+    MEM_TRACE(RESULT ? "[CAS]" : "[CAS FAILED]", ADDRESS, SIZE, RESULT ? UPDATE : *COMPARE);
+    return RESULT;
+}
+
+// DOUBLE COMPARE AND SWAP - BOTH UPDATES ARE WRITTEN ONLY IF BOTH OPERANDS MATCH THEIR COMPARES,
+// OTHERWISE BOTH COMPARES ARE LOADED WITH THEIR OPERANDS (AS CAS2 DOES WITH Dc1:Dc2)
+//
+// THE HOST CAN'T SWAP TWO INDEPENDENT OPERANDS IN ONE INSTRUCTION, SO CAS2 ALWAYS TAKES THE
+// SERIALISED PATH - INDIVISIBLE WITH RESPECT TO EVERY OTHER SERIALISED CYCLE, WITH THE SAME
+// CAVEAT AS MEM_CAS_SERIAL FOR A LOCK-FREE CYCLE ON THE SAME BYTES
+//
+// A FAULT ON EITHER OPERAND RETURNS FALSE WITH NEITHER COMPARE TOUCHED AND NOTHING WRITTEN
+
+static bool MEMORY_CAS2(uint32_t ADDRESS1, uint32_t ADDRESS2, uint32_t SIZE, uint32_t* COMPARE1, uint32_t* COMPARE2, uint32_t UPDATE1, uint32_t UPDATE2)
+{
+    M68K_MEM_BUFFER* MEM_BASE1 = NULL;
+    M68K_MEM_BUFFER* MEM_BASE2 = NULL;
+    uint32_t MASK = MEM_RMW_MASK(SIZE);
+
+    uint8_t* MEM_PTR1 = MEMORY_RMW_FIND(ADDRESS1, SIZE, &MEM_BASE1);
+
+    if(MEM_PTR1 == NULL)
+        return false;
+
+    uint8_t* MEM_PTR2 = MEMORY_RMW_FIND(ADDRESS2, SIZE, &MEM_BASE2);
+
+    if(MEM_PTR2 == NULL)
+        return false;
+
+    MEM_RMW_ACQUIRE();
+
+    uint32_t OLD1 = MEM_LOAD_SHARED(MEM_PTR1, SIZE);
+    uint32_t OLD2 = MEM_LOAD_SHARED(MEM_PTR2, SIZE);
+    bool RESULT = (OLD1 == (*COMPARE1 & MASK)) && (OLD2 == (*COMPARE2 & MASK));
+
+    if(RESULT)
+    {
+        MEM_STORE_SHARED(MEM_PTR1, SIZE, UPDATE1);
+        MEM_STORE_SHARED(MEM_PTR2, SIZE, UPDATE2);
+    }
+
+    MEM_RMW_RELEASE();
+
+    *COMPARE1 = OLD1;
+    *COMPARE2 = OLD2;
+
+    if(RESULT)
+    {
+        MEM_HASH_MARK(MEM_BASE1, MEM_PTR1 - MEM_BASE1->BUFFER, SIZE / 8);
+        MEM_HASH_MARK(MEM_BASE2, MEM_PTR2 - MEM_BASE2->BUFFER, SIZE / 8);
+    }
+
+    MEM_TRACE(RESULT ? "[CAS2]" : "[CAS2 FAILED]", ADDRESS1, SIZE, RESULT ? UPDATE1 : OLD1);
+    MEM_TRACE(RESULT ? "[CAS2]" : "[CAS2 FAILED]", ADDRESS2, SIZE, RESULT ? UPDATE2 : OLD2);
+    return RESULT;
+}
+
+// FETCH AND OP - THE ARITHMETIC IS DONE ON THE BIG ENDIAN VALUE, SO THIS
+// LOOPS ON A COMPARE AND SWAP RATHER THAN USING THE HOST'S OWN FETCH AND ADD
+
+static uint32_t MEMORY_FETCH_OP(uint32_t ADDRESS, uint32_t SIZE, M68K_MEM_RMW OP, uint32_t VALUE)
+{
+    M68K_MEM_BUFFER* MEM_BASE = NULL;
+    uint8_t* MEM_PTR = MEMORY_RMW_FIND(ADDRESS, SIZE, &MEM_BASE);
+
+    if(MEM_PTR == NULL)
+        return 0;
+
+    uint32_t OLD = MEM_LOAD_SHARED(MEM_PTR, SIZE);
+    uint32_t NEW = 0;
+
+    do
+    {
+        switch (OP)
+        {
+            case MEM_RMW_ADD:   NEW = OLD + VALUE; break;
+            case MEM_RMW_SUB:   NEW = OLD - VALUE; break;
+            case MEM_RMW_AND:   NEW = OLD & VALUE; break;
+            case MEM_RMW_OR:    NEW = OLD | VALUE; break;
+            case MEM_RMW_XOR:   NEW = OLD ^ VALUE; break;
+            case MEM_RMW_SWAP:  NEW = VALUE; break;
+        }
+
+    } while(!MEM_CAS_SHARED(MEM_PTR, SIZE, &OLD, NEW));
+
+    MEM_HASH_MARK(MEM_BASE, MEM_PTR - MEM_BASE->BUFFER, SIZE / 8);
+
+    MEM_TRACE("[FETCH OP]", ADDRESS, SIZE, OLD);
+    return OLD;
+}
+
+/////////////////////////////////////////////////////
+//             BUS LATENCY HISTOGRAMS
+/////////////////////////////////////////////////////
+
+// WITH THE LATENCY HOOK ON, EVERY ENTRY POINT GOES THROUGH BUS_TIMED - A SINGLE COUNTDOWN
+// DECIDES WHETHER AN ACCESS IS SAMPLED, SO UNSAMPLED ACCESSES PAY FOR ONE DECREMENT AND BRANCH
+//
+// THE TIME OF A SAMPLE COVERS EVERYTHING THE ACCESS DOES - DECODING, VALIDATION, BERR HANDLING,
+// THE COPY ITSELF AND ANY TRACE OUTPUT
+//
+// DEVICE THREADS GO THROUGH THE SAME ENTRY POINTS AS THE 68K SIDE, SO EACH THREAD COUNTS DOWN AND
+// TIMES IT'S OWN SAMPLES, WHEREAS THE HISTOGRAMS ARE SHARED AND ONLY EVER UPDATED WITH RELAXED ATOMICS
+// - NOTHING IS ORDERED BY THEM, SO THE SAMPLED PATH STAYS AS CHEAP AS IT WAS ON A SINGLE THREAD
+
+#if LATENCY_HOOK == M68K_OPT_ON
+
+static const char* M68K_LAT_PATH[] = { "READ", "WRITE", "MOVE", "RMW" };
+static const char* M68K_LAT_OUTCOME[] = { "OK", "UNMAPPED", "READONLY", "ALIGN", "BOUNDS", "BERR" };
+
+static inline uint64_t MEM_LATENCY_NS(void)
+{
+    struct timespec NOW;
+    clock_gettime(CLOCK_MONOTONIC, &NOW);
+    return ((uint64_t)NOW.tv_sec * 1000000000ULL) + (uint64_t)NOW.tv_nsec;
+}
+
+static inline uint64_t MEM_LATENCY_NOW(void)
+{
+#if M68K_LATENCY_RDTSC
+    return __builtin_ia32_rdtsc();
+#else
+    return MEM_LATENCY_NS();
+#endif
+}
+
+static inline unsigned MEM_LATENCY_BUCKET(uint64_t TICKS)
+{
+    if(TICKS < 4)
+        return (unsigned)TICKS;
+
+    unsigned MSB = 63 - __builtin_clzll(TICKS);
+    unsigned BUCKET = ((MSB - 1) * 4) + ((TICKS >> (MSB - 2)) & 3);
+
+    return (BUCKET < M68K_LATENCY_BUCKETS) ? BUCKET : M68K_LATENCY_BUCKETS - 1;
+}
+
+// THE SMALLEST NUMBER OF TICKS WHICH LANDS IN A GIVEN BUCKET
+
+static uint64_t MEM_LATENCY_BUCKET_LOW(unsigned BUCKET)
+{
+    if(BUCKET < 4)
+        return BUCKET;
+
+    return (uint64_t)(4 + (BUCKET & 3)) << ((BUCKET / 4) - 1);
+}
+
+// THE FIRST THREAD TO SAMPLE ANYTHING SETS THE ORIGIN - THE NANOSECONDS ARE CLAIMED FIRST AND
+// THE TICKS PUBLISHED AFTER THEM, SO NON-ZERO TICKS ALWAYS COME WITH THEIR NANOSECONDS
+
+__attribute__((cold, noinline))
+static void MEM_LATENCY_ORIGIN(void)
+{
+    uint64_t EXPECTED = 0;
+
+    if(__atomic_compare_exchange_n(&MEM_LATENCY_STATE.ORIGIN_NS, &EXPECTED, MEM_LATENCY_NS(), false, __ATOMIC_RELAXED, __ATOMIC_RELAXED))
+        __atomic_store_n(&MEM_LATENCY_STATE.ORIGIN_TICKS, MEM_LATENCY_NOW(), __ATOMIC_RELEASE);
+}
+
+static inline void MEM_LATENCY_BEGIN(void)
+{
+    MEM_LATENCY_SAMPLE.COUNTDOWN = __atomic_load_n(&MEM_LATENCY_STATE.RATE, __ATOMIC_RELAXED);
+    MEM_LATENCY_SAMPLE.FAULT = MEM_OK;
+
+    if(__atomic_load_n(&MEM_LATENCY_STATE.ORIGIN_TICKS, __ATOMIC_RELAXED) == 0)
+        MEM_LATENCY_ORIGIN();
+
+    MEM_LATENCY_SAMPLE.START = MEM_LATENCY_NOW();
+}
+
+static M68K_MEM_LATENCY_OUTCOME MEM_LATENCY_OUTCOME(M68K_MEM_ERROR ERROR)
+{
+    switch (ERROR)
+    {
+        case MEM_OK:                return MEM_LAT_OK;
+        case MEM_ERR_UNMAPPED:      return MEM_LAT_UNMAPPED;
+        case MEM_ERR_READONLY:      return MEM_LAT_READONLY;
+        case MEM_ERR_ALIGN:         return MEM_LAT_ALIGN;
+        case MEM_ERR_BERR:          return MEM_LAT_BERR;
+        default:                    return MEM_LAT_BOUNDS;
+    }
+}
+
+// CLOSE OFF A SAMPLE - THE REGION IS ONLY DECODED ONCE THE CLOCK HAS STOPPED SO THAT THE
+// LOOKUP ISN'T COUNTED AGAINST THE ACCESS IT'S DESCRIBING. THE OUTCOME IS THE FIRST FAULT RAISED
+//
+// HANDS BACK THE VALUE OF THE ACCESS, SO THAT BUS_TIMED CAN SIT WITHIN AN EXPRESSION
+//
+// NOTHING TAKES LESS THAN A TICK, WHICH LEAVES A MIN OF ZERO TO MEAN NOTHING HAS BEEN SAMPLED YET
+
+__attribute__((noinline))
+static uint32_t MEM_LATENCY_END(M68K_MEM_LATENCY_PATH PATH, uint32_t ADDRESS, uint32_t VALUE)
+{
+    uint64_t TICKS = MEM_LATENCY_NOW() - MEM_LATENCY_SAMPLE.START;
+    M68K_MEM_BUFFER* BUF = BUS_FIND(ADDRESS);
+
+    unsigned REGION = (BUF != NULL) ? (unsigned)(BUF - BUS_REGION_TABLE) : M68K_MAX_BUFFERS;
+    bool TRACED = IS_TRACE_ENABLED(M68K_OPT_BASIC) && CHECK_TRACE_CONDITION();
+
+    M68K_MEM_LATENCY* HIST = &MEM_LATENCY[REGION][PATH][MEM_LATENCY_OUTCOME(MEM_LATENCY_SAMPLE.FAULT)][TRACED];
+
+    if(TICKS == 0)
+        TICKS = 1;
+
+    uint64_t MIN = __atomic_load_n(&HIST->MIN, __ATOMIC_RELAXED);
+    uint64_t MAX = __atomic_load_n(&HIST->MAX, __ATOMIC_RELAXED);
+
+    while((MIN == 0 || TICKS < MIN) && 
+            !__atomic_compare_exchange_n(&HIST->MIN, &MIN, TICKS, true, __ATOMIC_RELAXED, __ATOMIC_RELAXED));
+
+    while(TICKS > MAX && 
+            !__atomic_compare_exchange_n(&HIST->MAX, &MAX, TICKS, true, __ATOMIC_RELAXED, __ATOMIC_RELAXED));
 
-        MEM_BASE->USAGE.READ_COUNT++;
-        MEM_BASE->USAGE.LAST_READ = ADDRESS;
-        MEM_BASE->USAGE.ACCESSED = true;
+    __atomic_fetch_add(&HIST->COUNT, 1, __ATOMIC_RELAXED);
+    __atomic_fetch_add(&HIST->TOTAL, TICKS, __ATOMIC_RELAXED);
+    __atomic_fetch_add(&HIST->BUCKETS[MEM_LATENCY_BUCKET(TICKS)], 1, __ATOMIC_RELAXED);
 
-        // THIS MEMORY POINTER WILL ALLOCATE ITSELF RELATIVE TO THE BUFFER
-        // AS WELL AS THE BIT SHIFT OFFSET THAT IS PRESENT WITH THE RESPECTIVE BIT VALUE
+    return VALUE;
+}
 
-        uint8_t* MEM_PTR = MEM_BASE->BUFFER + OFFSET;
-        uint32_t MEM_RETURN = 0;
+// A COPY OF ONE HISTOGRAM TO REPORT ON - TAKEN WHILE OTHER THREADS ARE STILL SAMPLING,
+// IT'S FIELDS MAY BE A SAMPLE OR TWO APART FROM ONE ANOTHER, BUT NEVER TORN
 
-        switch (SIZE)
+static void MEM_LATENCY_SNAPSHOT(const M68K_MEM_LATENCY* HIST, M68K_MEM_LATENCY* OUT)
+{
+    OUT->COUNT = __atomic_load_n(&HIST->COUNT, __ATOMIC_RELAXED);
+    OUT->TOTAL = __atomic_load_n(&HIST->TOTAL, __ATOMIC_RELAXED);
+    OUT->MIN = __atomic_load_n(&HIST->MIN, __ATOMIC_RELAXED);
+    OUT->MAX = __atomic_load_n(&HIST->MAX, __ATOMIC_RELAXED);
+
+    for(unsigned BUCKET = 0; BUCKET < M68K_LATENCY_BUCKETS; BUCKET++)
+    {
+        OUT->BUCKETS[BUCKET] = __atomic_load_n(&HIST->BUCKETS[BUCKET], __ATOMIC_RELAXED);
+    }
+}
+
+#define         BUS_TIMED(PATH, ADDRESS, EXPR) \
+                ((--MEM_LATENCY_SAMPLE.COUNTDOWN != 0) ? (uint32_t)(EXPR) : \
+                    (MEM_LATENCY_BEGIN(), MEM_LATENCY_END((PATH), (ADDRESS), (uint32_t)(EXPR))))
+
+// TICKS PER NANOSECOND, MEASURED ACROSS EVERYTHING SAMPLED SO FAR - SHOULD THAT
+// BE TOO SHORT A WINDOW TO GO ON, THE TWO CLOCKS ARE COMPARED FOR A FURTHER 10MS
+
+static double MEM_LATENCY_TICKS_PER_NS(void)
+{
+#if M68K_LATENCY_RDTSC
+    uint64_t ORIGIN_TICKS = 0;
+
+    // ANOTHER THREAD MAY HAVE CLAIMED THE ORIGIN AND NOT YET PUBLISHED IT'S TICKS
+    while((ORIGIN_TICKS = __atomic_load_n(&MEM_LATENCY_STATE.ORIGIN_TICKS, __ATOMIC_ACQUIRE)) == 0)
+        MEM_LATENCY_ORIGIN();
+
+    uint64_t ORIGIN_NS = __atomic_load_n(&MEM_LATENCY_STATE.ORIGIN_NS, __ATOMIC_RELAXED);
+
+    while(MEM_LATENCY_NS() - ORIGIN_NS < 10000000ULL);
+
+    return (double)(MEM_LATENCY_NOW() - ORIGIN_TICKS) / 
+           (double)(MEM_LATENCY_NS() - ORIGIN_NS);
+#else
+    return 1.0;
+#endif
+}
+
+// THE MIDPOINT OF THE BUCKET HOLDING THE GIVEN FRACTION OF SAMPLES, CLAMPED TO THE EXTREMES SEEN
+
+static uint64_t MEM_LATENCY_PERCENTILE(const M68K_MEM_LATENCY* HIST, double FRACTION)
+{
+    uint64_t RANK = (uint64_t)(FRACTION * HIST->COUNT);
+    uint64_t SEEN = 0;
+
+    if(RANK == 0)
+        RANK = 1;
+
+    for(unsigned BUCKET = 0; BUCKET < M68K_LATENCY_BUCKETS; BUCKET++)
+    {
+        SEEN += HIST->BUCKETS[BUCKET];
+
+        if(SEEN >= RANK)
         {
-            case MEM_SIZE_32:
-                MEM_RETURN = *MEM_PTR++;
-                MEM_RETURN = (MEM_RETURN << 8) | *MEM_PTR++;
-                MEM_RETURN = (MEM_RETURN << 8) | *MEM_PTR++;
-                MEM_RETURN = (MEM_RETURN << 8) | *MEM_PTR;
-                break;
-                
-            case MEM_SIZE_16:
-                MEM_RETURN = *MEM_PTR++;
-                MEM_RETURN = (MEM_RETURN << 8) | *MEM_PTR;
-                break;
-                
-            case MEM_SIZE_8:
-                MEM_RETURN = *MEM_PTR;
-                break;
+            uint64_t LOW = MEM_LATENCY_BUCKET_LOW(BUCKET);
+            uint64_t HIGH = (BUCKET + 1 < M68K_LATENCY_BUCKETS) ? MEM_LATENCY_BUCKET_LOW(BUCKET + 1) - 1 : HIST->MAX;
+            uint64_t MIDDLE = LOW + ((HIGH - LOW) / 2);
+
+            return (MIDDLE < HIST->MIN) ? HIST->MIN : (MIDDLE > HIST->MAX) ? HIST->MAX : MIDDLE;
         }
-        MEM_TRACE("[READ]", ADDRESS, SIZE, MEM_RETURN);
-        return MEM_RETURN;
     }
 
-    BUS_ERROR(BERR_UNMAPPED_READ, ADDRESS, MEM_READ, SIZE);
-    MEM_ERROR(MEM_ERR_UNMAPPED, SIZE, "NO BUFFER FOUND FOR ADDRESS: 0x%08X", ADDRESS);
+    return HIST->MAX;
+}
+
+static void MEM_LATENCY_REGION_NAME(unsigned REGION, char* OUT, size_t LENGTH)
+{
+    if(REGION < BUS_REGION_COUNT)
+        snprintf(OUT, LENGTH, "0x%08X-0x%08X", BUS_REGION_TABLE[REGION].BASE, BUS_REGION_TABLE[REGION].END);
+    else
+        snprintf(OUT, LENGTH, "%s", (REGION == M68K_MAX_BUFFERS) ? "UNMAPPED" : "UNMAPPED REGION");
+}
 
-MALFORMED_READ:
-    MEM_ERROR(MEM_ERR_BAD_READ, SIZE, "ADDRESS: 0x%08X", ADDRESS);
-    MEM_TRACE("[INVALID READ]", ADDRESS, SIZE, ~(uint32_t)0);
-    return 0;
+// SAMPLE ONE IN EVERY RATE ACCESSES (ONE BEING EVERY ACCESS)
+// ANY OTHER THREAD PICKS THE NEW RATE UP ONCE IT'S CURRENT COUNTDOWN RUNS OUT
+
+void MEMORY_LATENCY_SAMPLING(uint32_t RATE)
+{
+    __atomic_store_n(&MEM_LATENCY_STATE.RATE, (RATE == 0) ? 1 : RATE, __ATOMIC_RELAXED);
+    MEM_LATENCY_SAMPLE.COUNTDOWN = (RATE == 0) ? 1 : RATE;
+}
+
+// ONLY WHILE NO OTHER THREAD IS ON THE BUS - A SAMPLE LANDING MID RESET WOULD BE HALF CLEARED
+
+void MEMORY_LATENCY_RESET(void)
+{
+    memset(MEM_LATENCY, 0, sizeof(MEM_LATENCY));
+    __atomic_store_n(&MEM_LATENCY_STATE.ORIGIN_TICKS, 0, __ATOMIC_RELAXED);
+    __atomic_store_n(&MEM_LATENCY_STATE.ORIGIN_NS, 0, __ATOMIC_RELAXED);
+}
+
+void SHOW_MEMORY_LATENCY(void)
+{
+    const M68K_MEM_LATENCY* HIST = &MEM_LATENCY[0][0][0][0];
+    M68K_MEM_LATENCY ENTRY;
+    uint64_t SAMPLES = 0;
+    char REGION_NAME[32];
+
+    for(size_t INDEX = 0; INDEX < sizeof(MEM_LATENCY) / sizeof(M68K_MEM_LATENCY); INDEX++)
+    {
+        SAMPLES += __atomic_load_n(&HIST[INDEX].COUNT, __ATOMIC_RELAXED);
+    }
+
+    if(SAMPLES == 0)
+        return;
+
+    double TICKS_PER_NS = MEM_LATENCY_TICKS_PER_NS();
+
+    printf("\nBUS LATENCY: 1 IN %u ACCESSES SAMPLED (%s, %.2f TICKS/NS)\n", 
+            __atomic_load_n(&MEM_LATENCY_STATE.RATE, __ATOMIC_RELAXED), M68K_LATENCY_RDTSC ? "RDTSC" : "CLOCK_GETTIME", TICKS_PER_NS);
+    printf("-------------------------------------------------------------------------------------------------------------------\n");
+    printf("REGION                   PATH    OUTCOME    TRACE    SAMPLES    MEAN(NS)     P50(NS)     P99(NS)     MAX(NS)\n");
+    printf("-------------------------------------------------------------------------------------------------------------------\n");
+
+    for(unsigned REGION = 0; REGION <= M68K_MAX_BUFFERS; REGION++)
+    {
+        for(unsigned PATH = 0; PATH < MEM_LAT_PATHS; PATH++)
+        {
+            for(unsigned OUTCOME = 0; OUTCOME < MEM_LAT_OUTCOMES; OUTCOME++)
+            {
+                for(unsigned TRACED = 0; TRACED < 2; TRACED++)
+                {
+                    MEM_LATENCY_SNAPSHOT(&MEM_LATENCY[REGION][PATH][OUTCOME][TRACED], &ENTRY);
+
+                    if(ENTRY.COUNT == 0)
+                        continue;
+
+                    MEM_LATENCY_REGION_NAME(REGION, REGION_NAME, sizeof(REGION_NAME));
+
+                    printf("%-24s %-7s %-10s %-5s %10llu %11.1f %11.1f %11.1f %11.1f\n",
+                            REGION_NAME, M68K_LAT_PATH[PATH], M68K_LAT_OUTCOME[OUTCOME], TRACED ? "YES" : "NO",
+                            (unsigned long long)ENTRY.COUNT,
+                            ((double)ENTRY.TOTAL / ENTRY.COUNT) / TICKS_PER_NS,
+                            MEM_LATENCY_PERCENTILE(&ENTRY, 0.50) / TICKS_PER_NS,
+                            MEM_LATENCY_PERCENTILE(&ENTRY, 0.99) / TICKS_PER_NS,
+                            ENTRY.MAX / TICKS_PER_NS);
+                }
+            }
+        }
+    }
+
+    printf("-------------------------------------------------------------------------------------------------------------------\n");
+}
+
+// THE SAME HISTOGRAMS AS JSON, BUCKETS AND ALL, SO THAT P50/P99 CAN BE TRACKED ACROSS RELEASES
+// EACH BUCKET IS GIVEN AS THE LOWEST LATENCY (IN NS) WHICH FALLS WITHIN IT
+
+bool MEMORY_LATENCY_JSON(const char* PATH)
+{
+    FILE* OUT = fopen(PATH, "w");
+    M68K_MEM_LATENCY SNAPSHOT;
+    const M68K_MEM_LATENCY* ENTRY = &SNAPSHOT;
+    bool FIRST = true;
+
+    if(OUT == NULL)
+        return false;
+
+    double TICKS_PER_NS = MEM_LATENCY_TICKS_PER_NS();
+
+    fprintf(OUT, "{\n  \"clock\": \"%s\",\n  \"ticks_per_ns\": %.4f,\n  \"sample_rate\": %u,\n  \"histograms\": [",
+            M68K_LATENCY_RDTSC ? "rdtsc" : "clock_gettime", TICKS_PER_NS, __atomic_load_n(&MEM_LATENCY_STATE.RATE, __ATOMIC_RELAXED));
+
+    for(unsigned REGION = 0; REGION <= M68K_MAX_BUFFERS; REGION++)
+    {
+        for(unsigned PATH = 0; PATH < MEM_LAT_PATHS; PATH++)
+        {
+            for(unsigned OUTCOME = 0; OUTCOME < MEM_LAT_OUTCOMES; OUTCOME++)
+            {
+                for(unsigned TRACED = 0; TRACED < 2; TRACED++)
+                {
+                    bool FIRST_BUCKET = true;
+                    MEM_LATENCY_SNAPSHOT(&MEM_LATENCY[REGION][PATH][OUTCOME][TRACED], &SNAPSHOT);
+
+                    if(ENTRY->COUNT == 0)
+                        continue;
+
+                    fprintf(OUT, "%s\n    { \"region\": ", FIRST ? "" : ",");
+                    FIRST = false;
+
+                    if(REGION < BUS_REGION_COUNT)
+                        fprintf(OUT, "{ \"base\": %u, \"end\": %u }", BUS_REGION_TABLE[REGION].BASE, BUS_REGION_TABLE[REGION].END);
+                    else
+                        fprintf(OUT, "null");
+
+                    fprintf(OUT, ", \"path\": \"%s\", \"outcome\": \"%s\", \"traced\": %s, \"samples\": %llu, "
+                                 "\"mean_ns\": %.1f, \"p50_ns\": %.1f, \"p99_ns\": %.1f, \"min_ns\": %.1f, \"max_ns\": %.1f, \"buckets\": [",
+                            M68K_LAT_PATH[PATH], M68K_LAT_OUTCOME[OUTCOME], TRACED ? "true" : "false",
+                            (unsigned long long)ENTRY->COUNT,
+                            ((double)ENTRY->TOTAL / ENTRY->COUNT) / TICKS_PER_NS,
+                            MEM_LATENCY_PERCENTILE(ENTRY, 0.50) / TICKS_PER_NS,
+                            MEM_LATENCY_PERCENTILE(ENTRY, 0.99) / TICKS_PER_NS,
+                            ENTRY->MIN / TICKS_PER_NS,
+                            ENTRY->MAX / TICKS_PER_NS);
+
+                    for(unsigned BUCKET = 0; BUCKET < M68K_LATENCY_BUCKETS; BUCKET++)
+                    {
+                        if(ENTRY->BUCKETS[BUCKET] == 0)
+                            continue;
+
+                        fprintf(OUT, "%s{ \"ge_ns\": %.1f, \"count\": %u }", FIRST_BUCKET ? "" : ", ",
+                                MEM_LATENCY_BUCKET_LOW(BUCKET) / TICKS_PER_NS, ENTRY->BUCKETS[BUCKET]);
+
+                        FIRST_BUCKET = false;
+                    }
+
+                    fprintf(OUT, "] }");
+                }
+            }
+        }
+    }
+
+    fprintf(OUT, "\n  ]\n}\n");
+    fclose(OUT);
+    return true;
+}
+
+#else
+
+#define         BUS_TIMED(PATH, ADDRESS, EXPR)      (EXPR)
+
+#endif
+
+#define         BUS_TIMED_VOID(PATH, ADDRESS, EXPR) ((void)BUS_TIMED(PATH, ADDRESS, ((EXPR), 0)))
+
+////////////////////////////////////////////////////////////////////////////////////////
+//              EACH OF THESE WILL REPRESENT AN UNSIGNED INT VALUE   
+//                FROM THERE, BEING SIGNED A SIZE DEFINER
+//                  IN ACCORDANCE WITH AN ENUM VALUE
+////////////////////////////////////////////////////////////////////////////////////////
+
+unsigned int M68K_READ_MEMORY_8(unsigned int ADDRESS)  { return BUS_TIMED(MEM_LAT_READ, ADDRESS, BUS_READ(ADDRESS, MEM_SIZE_8)); }
+unsigned int M68K_READ_MEMORY_16(unsigned int ADDRESS) { return BUS_TIMED(MEM_LAT_READ, ADDRESS, BUS_READ(ADDRESS, MEM_SIZE_16)); }
+unsigned int M68K_READ_MEMORY_32(unsigned int ADDRESS) { return BUS_TIMED(MEM_LAT_READ, ADDRESS, BUS_READ(ADDRESS, MEM_SIZE_32)); }
+
+void M68K_WRITE_MEMORY_8(unsigned int ADDRESS, uint8_t VALUE)   { BUS_TIMED_VOID(MEM_LAT_WRITE, ADDRESS, BUS_WRITE(ADDRESS, MEM_SIZE_8, VALUE)); }
+void M68K_WRITE_MEMORY_16(unsigned int ADDRESS, uint16_t VALUE) { BUS_TIMED_VOID(MEM_LAT_WRITE, ADDRESS, BUS_WRITE(ADDRESS, MEM_SIZE_16, VALUE)); }
+void M68K_WRITE_MEMORY_32(unsigned int ADDRESS, uint32_t VALUE) { BUS_TIMED_VOID(MEM_LAT_WRITE, ADDRESS, BUS_WRITE(ADDRESS, MEM_SIZE_32, VALUE)); }
+
+void M68K_MOVE_MEMORY_8(unsigned SRC, unsigned DEST, unsigned COUNT)    { BUS_TIMED_VOID(MEM_LAT_MOVE, SRC, MEMORY_MOVE(SRC, DEST, MEM_SIZE_8, COUNT)); }
+void M68K_MOVE_MEMORY_16(unsigned SRC, unsigned DEST, unsigned COUNT)   { BUS_TIMED_VOID(MEM_LAT_MOVE, SRC, MEMORY_MOVE(SRC, DEST, MEM_SIZE_16, COUNT)); }
+void M68K_MOVE_MEMORY_32(unsigned SRC, unsigned DEST, unsigned COUNT)   { BUS_TIMED_VOID(MEM_LAT_MOVE, SRC, MEMORY_MOVE(SRC, DEST, MEM_SIZE_32, COUNT)); }
+
+unsigned int M68K_TAS_MEMORY_8(unsigned int ADDRESS) { return BUS_TIMED(MEM_LAT_RMW, ADDRESS, MEMORY_TAS(ADDRESS)); }
+
+bool M68K_CAS_MEMORY_8(unsigned int ADDRESS, uint32_t* COMPARE, uint8_t UPDATE)     { return BUS_TIMED(MEM_LAT_RMW, ADDRESS, MEMORY_CAS(ADDRESS, MEM_SIZE_8, COMPARE, UPDATE)); }
+bool M68K_CAS_MEMORY_16(unsigned int ADDRESS, uint32_t* COMPARE, uint16_t UPDATE)   { return BUS_TIMED(MEM_LAT_RMW, ADDRESS, MEMORY_CAS(ADDRESS, MEM_SIZE_16, COMPARE, UPDATE)); }
+bool M68K_CAS_MEMORY_32(unsigned int ADDRESS, uint32_t* COMPARE, uint32_t UPDATE)   { return BUS_TIMED(MEM_LAT_RMW, ADDRESS, MEMORY_CAS(ADDRESS, MEM_SIZE_32, COMPARE, UPDATE)); }
+
+bool M68K_CAS2_MEMORY_16(unsigned int ADDRESS1, unsigned int ADDRESS2, uint32_t* COMPARE1, uint32_t* COMPARE2, uint16_t UPDATE1, uint16_t UPDATE2) { return BUS_TIMED(MEM_LAT_RMW, ADDRESS1, MEMORY_CAS2(ADDRESS1, ADDRESS2, MEM_SIZE_16, COMPARE1, COMPARE2, UPDATE1, UPDATE2)); }
+bool M68K_CAS2_MEMORY_32(unsigned int ADDRESS1, unsigned int ADDRESS2, uint32_t* COMPARE1, uint32_t* COMPARE2, uint32_t UPDATE1, uint32_t UPDATE2) { return BUS_TIMED(MEM_LAT_RMW, ADDRESS1, MEMORY_CAS2(ADDRESS1, ADDRESS2, MEM_SIZE_32, COMPARE1, COMPARE2, UPDATE1, UPDATE2)); }
+
+unsigned int M68K_FETCH_OP_MEMORY_8(unsigned int ADDRESS, M68K_MEM_RMW OP, uint8_t VALUE)     { return BUS_TIMED(MEM_LAT_RMW, ADDRESS, MEMORY_FETCH_OP(ADDRESS, MEM_SIZE_8, OP, VALUE)); }
+unsigned int M68K_FETCH_OP_MEMORY_16(unsigned int ADDRESS, M68K_MEM_RMW OP, uint16_t VALUE)   { return BUS_TIMED(MEM_LAT_RMW, ADDRESS, MEMORY_FETCH_OP(ADDRESS, MEM_SIZE_16, OP, VALUE)); }
+unsigned int M68K_FETCH_OP_MEMORY_32(unsigned int ADDRESS, M68K_MEM_RMW OP, uint32_t VALUE)   { return BUS_TIMED(MEM_LAT_RMW, ADDRESS, MEMORY_FETCH_OP(ADDRESS, MEM_SIZE_32, OP, VALUE)); }
+
+// OF COURSE THESE ARE CHANGED IN LIB68K TO HAVE NO LOCAL ARGS
+// AS THE IMMEDIATE READ IS GOVERNED BY THE EA LOADED INTO MEMORY
+
+unsigned int M68K_READ_IMM_16(unsigned int ADDRESS)
+{
+    bool TRACE = TRACE_ENABLED;
+    TRACE_ENABLED = false;
+
+    unsigned int RESULT = M68K_READ_MEMORY_16(ADDRESS);
+    TRACE_ENABLED = TRACE;
+
+    return RESULT;
+}
+
+unsigned int M68K_READ_IMM_32(unsigned int ADDRESS)
+{
+    bool TRACE = TRACE_ENABLED;
+    TRACE_ENABLED = false;
+
+    unsigned int RESULT = M68K_READ_MEMORY_32(ADDRESS);
+    TRACE_ENABLED = TRACE;
+
+    return RESULT;
+}
+
+#if VALIDATE_HOOK == M68K_OPT_ON
+
+/////////////////////////////////////////////////////
+//            DIFFERENTIAL VALIDATION
+/////////////////////////////////////////////////////
+
+// RANDOMISED STREAMS OF BUS OPERATIONS ARE GENERATED OVER RANDOMISED REGION LAYOUTS AND RUN
+// THROUGH EACH LANE BELOW - THE FIRST BEING THE REFERENCE SEMANTICS OF MEMORY_READ, MEMORY_WRITE,
+// MEMORY_MOVE AND THE LOCKED CYCLES. EVERY OTHER LANE MUST OBSERVE EXACTLY THE SAME VALUES,
+// FAULT EVENTS, BERR STATE, USAGE COUNTERS AND FINAL BUS HASH
+//
+// THE BUS IS A SET OF GLOBALS, SO THE WORK IS SHARDED ACROSS ONE FORKED WORKER PER CORE
+// EACH WITH IT'S OWN SEED - THREADS WOULD ALL BE CONTENDING FOR THE ONE BUS
+
+typedef enum
+{
+    VALIDATE_READ,
+    VALIDATE_WRITE,
+    VALIDATE_MOVE,
+    VALIDATE_IMM,
+    VALIDATE_TAS,
+    VALIDATE_CAS,
+    VALIDATE_CAS2,
+    VALIDATE_FETCH_OP,
+    VALIDATE_ACK
+
+} M68K_VALIDATE_KIND;
+
+// DEST DOUBLES AS THE COMPARE OPERAND OF A CAS, AND COUNT AS THE M68K_MEM_RMW OF A FETCH_OP
+// A CAS2 TAKES IT'S SECOND OPERAND FROM DEST, IT'S UPDATES FROM VALUE AND ~VALUE, AND THE LOW
+// TWO BITS OF COUNT SAY WHETHER EACH COMPARE IS THAT UPDATE OR ZERO (SEE VALIDATE_CAS2_COMPARE)
+
+typedef struct
+{
+    uint8_t KIND;
+    uint8_t SIZE;
+    uint16_t COUNT;
+    uint32_t ADDRESS;
+    uint32_t DEST;
+    uint32_t VALUE;
+
+} M68K_VALIDATE_OP;
+
+typedef struct
+{
+    uint32_t BASE;
+    uint32_t END;
+    bool WRITE;
+    bool BERR;
+
+} M68K_VALIDATE_REGION;
+
+typedef struct
+{
+    unsigned REGION_COUNT;
+    unsigned OP_COUNT;
+    M68K_VALIDATE_REGION REGIONS[M68K_MAX_BUFFERS];
+    M68K_VALIDATE_OP OPS[M68K_VALIDATE_OPS];
+
+} M68K_VALIDATE_STREAM;
+
+// A LANE IS THE MAP FLAGS EVERY REGION IS MAPPED WITH, AND WHETHER ACCESSES GO THROUGH
+// THE PUBLIC ENTRY POINTS RATHER THAN STRAIGHT TO THE REFERENCE FUNCTIONS
+//
+// THE INCREMENTAL LANE HASHES THE BUS BEFORE THE STREAM IS RUN, SO THAT IT'S FINAL HASH
+// IS BUILT FROM THE PAGES MARKED DIRTY ALONG THE WAY RATHER THAN FROM SCRATCH
+//
+// A LANE ONLY RUNS ON ONE IN EVERY N STREAMS - THE HUGE PAGE LANE MAPS AND PREFAULTS 2MB FOR EACH
+// REGION, WHICH WOULD OTHERWISE COST FAR MORE THAN THE STREAM ITSELF. A DIVERGING STREAM IS
+// SHRUNK AND REPORTED WITH EVERY LANE RUNNING
+//
+// WITH THE STATIC MAP, THE ENTRY POINTS ROUTE THROUGH THE GENERATED DECODER WHEREAS THE REFERENCE
+// LANE ALIASES THE STATIC DESCRIPTORS INTO MEM_BUFFERS (AS STATIC_MAP_CROSS_CHECK DOES) SO THAT IT'S
+// READS, WRITES AND IMMEDIATE FETCHES ARE DECODED BY MEM_FIND. MOVES AND LOCKED CYCLES DECODE THROUGH
+// BUS_FIND ON EITHER SIDE, SO FOR THOSE THE STATIC LANES ONLY COVER WHAT FOLLOWS THE DECODE
+
+typedef struct
+{
+    const char* NAME;
+    uint32_t FLAGS;
+    bool ENTRY_POINTS;
+    bool INCREMENTAL_HASH;
+    unsigned EVERY;
+
+} M68K_VALIDATE_LANE;
+
+static const M68K_VALIDATE_LANE VALIDATE_LANES[] =
+{
+    { "REFERENCE",      M68K_MAP_NONE,      false,  false,  1 },
+#if STATIC_MAP_HOOK == M68K_OPT_ON
+    { "STATIC",         M68K_MAP_NONE,      true,   false,  1 },
+    { "STATIC INCREMENTAL",  M68K_MAP_NONE,  true,   true,   1 },
+#else
+    { "SHARED",         M68K_MAP_SHARED,    true,   false,  1 },
+    { "INCREMENTAL",    M68K_MAP_NONE,      true,   true,   1 },
+    { "HUGE PAGE",      M68K_MAP_THP | M68K_MAP_POPULATE,  true,   false,  16 },
+#endif
+};
+
+#define         VALIDATE_NUM_LANES              (sizeof(VALIDATE_LANES) / sizeof(VALIDATE_LANES[0]))
+#define         VALIDATE_BATCH                  16
+
+typedef struct
+{
+    uint64_t OPS;
+    uint64_t STREAMS;
+    uint64_t MISMATCHES;
+
+} M68K_VALIDATE_RESULT;
+
+static M68K_VALIDATE_STREAM VALIDATE_STREAM;
+static M68K_VALIDATE_STREAM VALIDATE_CANDIDATE;
+static uint64_t VALIDATE_EXPECTED[M68K_VALIDATE_OPS + 1];
+
+// SPLITMIX64 - EVERY STREAM IS A PURE FUNCTION OF IT'S SEED
+
+static inline uint64_t VALIDATE_RANDOM(uint64_t* STATE)
+{
+    uint64_t RESULT = (*STATE += 0x9E3779B97F4A7C15ULL);
+    RESULT = (RESULT ^ (RESULT >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    RESULT = (RESULT ^ (RESULT >> 27)) * 0x94D049BB133111EBULL;
+    return RESULT ^ (RESULT >> 31);
+}
+
+#define         VALIDATE_BELOW(STATE, N)        ((uint32_t)(VALIDATE_RANDOM(STATE) % (N)))
+
+static double VALIDATE_NOW(void)
+{
+    struct timespec NOW;
+    clock_gettime(CLOCK_MONOTONIC, &NOW);
+    return (double)NOW.tv_sec + (double)NOW.tv_nsec / 1e9;
+}
+
+// EACH REGION IS PLACED WITHIN IT'S OWN SLOT OF THE ADDRESS SPACE SO THAT THEY NEVER OVERLAP
+// TINY, ODD SIZED, ODD BASED AND BACK TO BACK REGIONS ARE DELIBERATELY COMMON, AS THAT IS WHERE THE EDGES ARE
+
+static void VALIDATE_LAYOUT(M68K_VALIDATE_STREAM* STREAM, uint64_t* STATE)
+{
+#if STATIC_MAP_HOOK == M68K_OPT_ON
+    (void)STATE;
+    STREAM->REGION_COUNT = STATIC_NUM_REGIONS;
+
+    for(unsigned INDEX = 0; INDEX < STATIC_NUM_REGIONS; INDEX++)
+    {
+        STREAM->REGIONS[INDEX].BASE = STATIC_BUFFERS[INDEX].BASE;
+        STREAM->REGIONS[INDEX].END = STATIC_BUFFERS[INDEX].END;
+        STREAM->REGIONS[INDEX].WRITE = STATIC_BUFFERS[INDEX].WRITE;
+        STREAM->REGIONS[INDEX].BERR = STATIC_BUFFERS[INDEX].BERR;
+    }
+
+    return;
+#endif
+
+    STREAM->REGION_COUNT = 1 + VALIDATE_BELOW(STATE, M68K_MAX_BUFFERS);
+    uint32_t SLOT = M68K_MAX_MEMORY_SIZE / STREAM->REGION_COUNT;
+
+    for(unsigned INDEX = 0; INDEX < STREAM->REGION_COUNT; INDEX++)
+    {
+        M68K_VALIDATE_REGION* REGION = &STREAM->REGIONS[INDEX];
+        uint32_t SIZE = VALIDATE_BELOW(STATE, 4) ? 1 + VALIDATE_BELOW(STATE, M68K_VALIDATE_MAX_REGION) : 1 + VALIDATE_BELOW(STATE, 16);
+
+        if(INDEX > 0 && VALIDATE_BELOW(STATE, 4) == 0)
+            REGION->BASE = STREAM->REGIONS[INDEX - 1].END + 1;
+        else
+            REGION->BASE = (SLOT * INDEX) + VALIDATE_BELOW(STATE, SLOT - SIZE);
+
+        REGION->END = REGION->BASE + SIZE - 1;
+        REGION->WRITE = VALIDATE_BELOW(STATE, 4) != 0;
+        REGION->BERR = VALIDATE_BELOW(STATE, 2) != 0;
+    }
+}
+
+static uint32_t VALIDATE_ADDRESS(const M68K_VALIDATE_STREAM* STREAM, uint64_t* STATE)
+{
+    const M68K_VALIDATE_REGION* REGION = &STREAM->REGIONS[VALIDATE_BELOW(STATE, STREAM->REGION_COUNT)];
+
+    switch (VALIDATE_BELOW(STATE, 8))
+    {
+        // EITHER SIDE OF THE START OR THE END OF A REGION
+        case 0:     return REGION->BASE - 4 + VALIDATE_BELOW(STATE, 8);
+        case 1:     return REGION->END - 3 + VALIDATE_BELOW(STATE, 8);
+
+        // ANYWHERE ON (OR JUST BEYOND) THE BUS - MOSTLY UNMAPPED
+        case 2:     return VALIDATE_BELOW(STATE, M68K_MAX_MEMORY_SIZE + 0x100);
+
+        default:    return REGION->BASE + VALIDATE_BELOW(STATE, REGION->END - REGION->BASE + 1);
+    }
+}
+
+static void VALIDATE_GENERATE(M68K_VALIDATE_STREAM* STREAM, uint64_t SEED)
+{
+    static const uint8_t SIZES[] = { MEM_SIZE_8, MEM_SIZE_16, MEM_SIZE_32 };
+    uint64_t STATE = SEED;
+
+    VALIDATE_LAYOUT(STREAM, &STATE);
+    STREAM->OP_COUNT = M68K_VALIDATE_OPS;
+
+    for(unsigned INDEX = 0; INDEX < STREAM->OP_COUNT; INDEX++)
+    {
+        M68K_VALIDATE_OP* OP = &STREAM->OPS[INDEX];
+        uint32_t ROLL = VALIDATE_BELOW(&STATE, 100);
+
+        OP->KIND = (ROLL < 32) ? VALIDATE_READ :
+                   (ROLL < 64) ? VALIDATE_WRITE :
+                   (ROLL < 72) ? VALIDATE_MOVE :
+                   (ROLL < 80) ? VALIDATE_IMM :
+                   (ROLL < 83) ? VALIDATE_TAS :
+                   (ROLL < 86) ? VALIDATE_CAS :
+                   (ROLL < 88) ? VALIDATE_CAS2 :
+                   (ROLL < 92) ? VALIDATE_FETCH_OP : VALIDATE_ACK;
+
+        OP->SIZE = SIZES[VALIDATE_BELOW(&STATE, 3)];
+        OP->COUNT = VALIDATE_BELOW(&STATE, M68K_VALIDATE_MAX_MOVE + 1);
+        OP->ADDRESS = VALIDATE_ADDRESS(STREAM, &STATE);
+        OP->DEST = VALIDATE_ADDRESS(STREAM, &STATE);
+        OP->VALUE = (uint32_t)VALIDATE_RANDOM(&STATE);
+
+        // IMMEDIATE FETCHES ARE ONLY EVER WORDS OR LONGS, TAS ONLY EVER A BYTE
+        if(OP->KIND == VALIDATE_IMM && OP->SIZE == MEM_SIZE_8)
+            OP->SIZE = MEM_SIZE_16;
+
+        if(OP->KIND == VALIDATE_TAS)
+            OP->SIZE = MEM_SIZE_8;
+
+        // CAS2 ONLY EVER WORDS OR LONGS, LIKE THE IMMEDIATE FETCHES
+        if(OP->KIND == VALIDATE_CAS2)
+        {
+            OP->SIZE = (OP->SIZE == MEM_SIZE_8) ? MEM_SIZE_16 : OP->SIZE;
+            OP->COUNT &= 3;
+        }
+
+        // THE ENTRY POINTS TAKE THE OPERAND AT IT'S OWN SIZE - AND AS MEMORY STARTS OUT
+        // CLEARED, A COMPARE OF ZERO IS THE ONE MOST LIKELY TO ACTUALLY SWAP
+        if(OP->KIND == VALIDATE_CAS || OP->KIND == VALIDATE_FETCH_OP)
+        {
+            OP->VALUE = (OP->SIZE == MEM_SIZE_32) ? OP->VALUE : OP->VALUE & ((1U << OP->SIZE) - 1);
+            OP->DEST = VALIDATE_BELOW(&STATE, 2) ? 0 : (uint32_t)VALIDATE_RANDOM(&STATE);
+            OP->COUNT %= (MEM_RMW_SWAP + 1);
+        }
+
+        // KEEP MOST WIDER ACCESSES ALIGNED, SO THAT THEY GET PAST THE ALIGNMENT CHECK
+        if(OP->SIZE != MEM_SIZE_8 && VALIDATE_BELOW(&STATE, 4))
+        {
+            OP->ADDRESS &= ~1U;
+            OP->DEST &= ~1U;
+        }
+    }
+}
+
+#define         VALIDATE_CAS2_COMPARE(OP, BIT, UPDATE)  (((OP)->COUNT & (BIT)) ? ((UPDATE) & MEM_RMW_MASK((OP)->SIZE)) : 0)
+
+// THE LOWER HALF OF THE RESULT IS THE VALUE THE OPERATION RETURNED - A CAS RETURNS
+// WHAT IS LEFT IN COMPARE, WITH WHETHER IT SWAPPED IN THE UPPER HALF (A CAS2 FOLDS BOTH COMPARES)
+
+static uint64_t VALIDATE_ACCESS(const M68K_VALIDATE_OP* OP, bool ENTRY_POINTS)
+{
+    uint32_t COMPARE = OP->DEST;
+    bool SWAPPED = false;
+
+    switch (OP->KIND)
+    {
+        case VALIDATE_READ:
+            if(!ENTRY_POINTS)
+                return MEMORY_READ(OP->ADDRESS, OP->SIZE);
+
+            if(OP->SIZE == MEM_SIZE_8)  return M68K_READ_MEMORY_8(OP->ADDRESS);
+            if(OP->SIZE == MEM_SIZE_16) return M68K_READ_MEMORY_16(OP->ADDRESS);
+            return M68K_READ_MEMORY_32(OP->ADDRESS);
+
+        case VALIDATE_WRITE:
+            if(!ENTRY_POINTS)                   MEMORY_WRITE(OP->ADDRESS, OP->SIZE, OP->VALUE);
+            else if(OP->SIZE == MEM_SIZE_8)     M68K_WRITE_MEMORY_8(OP->ADDRESS, OP->VALUE);
+            else if(OP->SIZE == MEM_SIZE_16)    M68K_WRITE_MEMORY_16(OP->ADDRESS, OP->VALUE);
+            else                                M68K_WRITE_MEMORY_32(OP->ADDRESS, OP->VALUE);
+            return 0;
+
+        case VALIDATE_MOVE:
+            if(!ENTRY_POINTS)                   MEMORY_MOVE(OP->ADDRESS, OP->DEST, OP->SIZE, OP->COUNT);
+            else if(OP->SIZE == MEM_SIZE_8)     M68K_MOVE_MEMORY_8(OP->ADDRESS, OP->DEST, OP->COUNT);
+            else if(OP->SIZE == MEM_SIZE_16)    M68K_MOVE_MEMORY_16(OP->ADDRESS, OP->DEST, OP->COUNT);
+            else                                M68K_MOVE_MEMORY_32(OP->ADDRESS, OP->DEST, OP->COUNT);
+            return 0;
+
+        case VALIDATE_IMM:
+            if(!ENTRY_POINTS)
+                return MEMORY_READ(OP->ADDRESS, OP->SIZE);
+
+            return (OP->SIZE == MEM_SIZE_16) ? M68K_READ_IMM_16(OP->ADDRESS) : M68K_READ_IMM_32(OP->ADDRESS);
+
+        case VALIDATE_TAS:
+            return ENTRY_POINTS ? M68K_TAS_MEMORY_8(OP->ADDRESS) : MEMORY_TAS(OP->ADDRESS);
+
+        case VALIDATE_CAS:
+            if(!ENTRY_POINTS)                   SWAPPED = MEMORY_CAS(OP->ADDRESS, OP->SIZE, &COMPARE, OP->VALUE);
+            else if(OP->SIZE == MEM_SIZE_8)     SWAPPED = M68K_CAS_MEMORY_8(OP->ADDRESS, &COMPARE, OP->VALUE);
+            else if(OP->SIZE == MEM_SIZE_16)    SWAPPED = M68K_CAS_MEMORY_16(OP->ADDRESS, &COMPARE, OP->VALUE);
+            else                                SWAPPED = M68K_CAS_MEMORY_32(OP->ADDRESS, &COMPARE, OP->VALUE);
+            return ((uint64_t)SWAPPED << 32) | COMPARE;
+
+        case VALIDATE_CAS2:
+        {
+            uint32_t COMPARE1 = VALIDATE_CAS2_COMPARE(OP, 1, OP->VALUE);
+            uint32_t COMPARE2 = VALIDATE_CAS2_COMPARE(OP, 2, ~OP->VALUE);
+
+            if(!ENTRY_POINTS)                   SWAPPED = MEMORY_CAS2(OP->ADDRESS, OP->DEST, OP->SIZE, &COMPARE1, &COMPARE2, OP->VALUE, ~OP->VALUE);
+            else if(OP->SIZE == MEM_SIZE_16)    SWAPPED = M68K_CAS2_MEMORY_16(OP->ADDRESS, OP->DEST, &COMPARE1, &COMPARE2, OP->VALUE, ~OP->VALUE);
+            else                                SWAPPED = M68K_CAS2_MEMORY_32(OP->ADDRESS, OP->DEST, &COMPARE1, &COMPARE2, OP->VALUE, ~OP->VALUE);
+            return ((uint64_t)SWAPPED << 32) | (COMPARE1 ^ ((COMPARE2 << 16) | (COMPARE2 >> 16)));
+        }
+
+        case VALIDATE_FETCH_OP:
+            if(!ENTRY_POINTS)
+                return MEMORY_FETCH_OP(OP->ADDRESS, OP->SIZE, (M68K_MEM_RMW)OP->COUNT, OP->VALUE);
+
+            if(OP->SIZE == MEM_SIZE_8)  return M68K_FETCH_OP_MEMORY_8(OP->ADDRESS, (M68K_MEM_RMW)OP->COUNT, OP->VALUE);
+            if(OP->SIZE == MEM_SIZE_16) return M68K_FETCH_OP_MEMORY_16(OP->ADDRESS, (M68K_MEM_RMW)OP->COUNT, OP->VALUE);
+            return M68K_FETCH_OP_MEMORY_32(OP->ADDRESS, (M68K_MEM_RMW)OP->COUNT, OP->VALUE);
+
+        default:
+            BERR_ACKNOWLEDGE();
+            return 0;
+    }
+}
+
+// FOLD EVERYTHING AN OPERATION LEFT BEHIND INTO A SINGLE VALUE - WHAT IT RETURNED,
+// EVERY FAULT IT RAISED AND THE STATE OF THE BERR LINE AFTERWARDS
+
+static uint64_t VALIDATE_OBSERVE(uint64_t VALUE)
+{
+    M68K_BERR_EVENT EVENT;
+
+    uint64_t RESULT = ((uint64_t)(uint32_t)VALUE << 32) | ((uint32_t)BERR_STATE.TYPE << 8) | ((uint32_t)(VALUE >> 32) << 3) |
+                      ((uint32_t)BERR_STATE.ACTIVE << 2) | ((uint32_t)BERR_STATE.DOUBLE_FAULT << 1) | (M68K_STOPPED != 0);
+
+    while(BERR_QUEUE_DRAIN(&EVENT, 1))
+    {
+        RESULT = MEM_HASH_COMBINE(RESULT, ((uint64_t)EVENT.ADDRESS << 32) | ((uint32_t)EVENT.TYPE << 24) |
+                    ((uint32_t)EVENT.ERROR << 16) | ((uint32_t)(uint8_t)EVENT.OP << 8) | 
+                    ((uint32_t)EVENT.DOUBLE_FAULT << 7) | EVENT.SIZE);
+    }
+
+    return RESULT;
+}
+
+static uint64_t VALIDATE_OBSERVE_BUS(void)
+{
+    uint64_t RESULT = BUS_HASH();
+
+    for(unsigned INDEX = 0; INDEX < BUS_REGION_COUNT; INDEX++)
+    {
+        const M68K_MEM_USAGE* USAGE = BUS_REGION_TABLE[INDEX].USAGE;
+
+        uint32_t COUNTERS[] = 
+        { 
+            USAGE->READ_COUNT, USAGE->WRITE_COUNT, USAGE->MOVE_COUNT, 
+            USAGE->LAST_READ, USAGE->LAST_WRITE, USAGE->LAST_MOVE_SRC, USAGE->LAST_MOVE_DEST, 
+            USAGE->VIOLATION, USAGE->BUS_ERROR, USAGE->ACCESSED 
+        };
+
+        RESULT = MEM_HASH_COMBINE(RESULT, XXH64((const uint8_t*)COUNTERS, sizeof(COUNTERS), INDEX));
+    }
+
+    return MEM_HASH_COMBINE(RESULT, ((uint64_t)BERR_STATE.CURRENT_ADDRESS << 32) | BERR_STATE.FAULT_COUNT);
 }
 
-// NOW DO THE SAME FOR WRITES
+// RUN A STREAM THROUGH ONE LANE - THE REFERENCE LANE RECORDS WHAT IT OBSERVED
+// AND EVERY OTHER LANE COMPARES AGAINST THAT AS IT GOES
+//
+// RETURNS THE INDEX OF THE FIRST OPERATION TO DIVERGE (OP_COUNT BEING THE FINAL BUS STATE) OR -1
 
-static void MEMORY_WRITE(uint32_t ADDRESS, uint32_t SIZE, uint32_t VALUE)
+static int VALIDATE_RUN(const M68K_VALIDATE_STREAM* STREAM, const M68K_VALIDATE_LANE* LANE, bool RECORD, uint64_t* ACTUAL)
 {
-    M68K_MEM_BUFFER* MEM_BASE = MEM_FIND(ADDRESS);
-
-    VERBOSE_TRACE("ATTEMPTING WRITE TO ADDRESS: 0x%X (SIZE = %d, VALUE = 0x%X)\n", ADDRESS, SIZE, VALUE);
+    MEMORY_UNMAP_ALL();
 
-    // CHECK FOR POSSIBLE ALIGNMENT ISSUES WITHIN THE BUS HANDLER
-    if(!M68K_BUS_ALIGNMENT(ADDRESS, SIZE))
+#if STATIC_MAP_HOOK == M68K_OPT_ON
+    // THE STATIC STORAGE OUTLIVES EVERY LANE, SO IT'S CLEARED BY HAND - AND IT'S TREES ARE RELEASED
+    // BEFORE ANY ALIASING, SO THAT NO ALIAS EVER SHARES ONE WITH IT'S STATIC DESCRIPTOR
+    for(unsigned INDEX = 0; INDEX < STATIC_NUM_REGIONS; INDEX++)
     {
-        MEM_ERROR(MEM_ERR_ALIGN, SIZE, "MISALIGNED ADDRESS AT: 0x%08X", ADDRESS);
-        goto MALFORMED_WRITE;
+        memset(STATIC_BUFFERS[INDEX].BUFFER, 0, STATIC_BUFFERS[INDEX].SIZE);
+        MEMORY_HASH_FREE(&STATIC_BUFFERS[INDEX].HASH);
     }
 
-    // BOUND CHECKS FOR INVALID ADDRESSING
-    if(ADDRESS > M68K_MAX_ADDR_END || ADDRESS > M68K_MAX_MEMORY_SIZE)
+    memset(STATIC_USAGE, 0, sizeof(STATIC_USAGE));
+
+    if(!LANE->ENTRY_POINTS)
     {
-        MEM_ERROR(MEM_ERR_RESERVED, SIZE, "ATTEMPT TO WRITE TO RESERVED ADDRESS RANGE: 0x%X", ADDRESS);
-        MEM_ERROR(MEM_ERR_BOUNDS, SIZE, "ATTEMPT TO WRITE TO AN ADDRESS RANGE BEYOND THE ADDRESSABLE SPACE: 0x%X", ADDRESS);
-        goto MALFORMED_WRITE;
+        memcpy(MEM_BUFFERS, STATIC_BUFFERS, sizeof(STATIC_BUFFERS));
+        MEM_NUM_BUFFERS = STATIC_NUM_REGIONS;
     }
+#else
+    for(unsigned INDEX = 0; INDEX < STREAM->REGION_COUNT; INDEX++)
+    {
+        const M68K_VALIDATE_REGION* REGION = &STREAM->REGIONS[INDEX];
+        MEMORY_MAP_EX(REGION->BASE, REGION->END, REGION->WRITE, REGION->BERR, LANE->FLAGS);
+    }
+#endif
 
-    if(MEM_BASE != NULL)
+    if(LANE->INCREMENTAL_HASH)
+        BUS_HASH();
+
+    for(unsigned INDEX = 0; INDEX <= STREAM->OP_COUNT; INDEX++)
     {
-        // BEFORE ANYTHING, WE NEED TO VALIDATE IF THE MEMORY MAP
-        // IS EITHER RW OR JUST RO
+        uint64_t RESULT = 0;
 
-        if(!MEM_BASE->WRITE) 
+        if(INDEX < STREAM->OP_COUNT)
         {
-            MEM_BASE->USAGE.VIOLATION++;
-            MEM_BASE->USAGE.BUS_ERROR++;
-            MEM_ERROR(MEM_ERR_READONLY, SIZE, "WRITE ATTEMPT TO READ-ONLY MEMORY AT 0x%0x, VIOLATION #%u", ADDRESS, MEM_BASE->USAGE.VIOLATION);
-            goto MALFORMED_WRITE;
+            M68K_PC = INDEX * 2;
+            RESULT = VALIDATE_OBSERVE(VALIDATE_ACCESS(&STREAM->OPS[INDEX], LANE->ENTRY_POINTS));
         }
+        else
+        {
+            // THE ALIASES WOULD OTHERWISE BE FOLDED INTO BUS_HASH ALONGSIDE THE STATIC DESCRIPTORS
+            #if STATIC_MAP_HOOK == M68K_OPT_ON
+            MEM_NUM_BUFFERS = 0;
+            #endif
 
-        uint32_t OFFSET = (ADDRESS - MEM_BASE->BASE);
-        uint32_t BYTES = SIZE / 8;
+            RESULT = VALIDATE_OBSERVE_BUS();
+        }
 
-        if((OFFSET + BYTES - 1) > MEM_BASE->SIZE) 
+        if(RECORD)
+            VALIDATE_EXPECTED[INDEX] = RESULT;
+
+        else if(VALIDATE_EXPECTED[INDEX] != RESULT)
         {
-            MEM_BASE->USAGE.VIOLATION++;
-            MEM_BASE->USAGE.BUS_ERROR++;
-            BUS_ERROR(BERR_BOUNDS, ADDRESS, MEM_WRITE, SIZE);
-            MEM_ERROR(MEM_ERR_BOUNDS, SIZE, "WRITE OUT OF BOUNDS: OFFSET = %d, SIZE = %d, VIOLATION #%u", OFFSET, BYTES, MEM_BASE->USAGE.VIOLATION);
-            goto MALFORMED_WRITE;
+            if(ACTUAL != NULL) *ACTUAL = RESULT;
+            return (int)INDEX;
         }
+    }
 
-        // DETERMINE IF THE BERR PULSE LINE IS ENABLED FOR THIS BUFFER
-        if(MEM_BASE->BERR && BERR_STATE.ACTIVE)
+    return -1;
+}
+
+// WHETHER A LANE RUNS ON THE NTH STREAM - STREAM ZERO BEING RUN THROUGH EVERY LANE
+
+#define         VALIDATE_SAMPLED(LANE, STREAM)  (((STREAM) % VALIDATE_LANES[LANE].EVERY) == 0)
+
+// RETURNS THE FIRST LANE WHICH DISAGREES WITH THE REFERENCE, OR ZERO WHEN THEY ALL AGREE
+
+static unsigned VALIDATE_DIVERGES(const M68K_VALIDATE_STREAM* STREAM, uint64_t ORDINAL, int* INDEX, uint64_t* ACTUAL)
+{
+    VALIDATE_RUN(STREAM, &VALIDATE_LANES[0], true, NULL);
+
+    for(unsigned LANE = 1; LANE < VALIDATE_NUM_LANES; LANE++)
+    {
+        if(!VALIDATE_SAMPLED(LANE, ORDINAL))
+            continue;
+
+        int AT = VALIDATE_RUN(STREAM, &VALIDATE_LANES[LANE], false, ACTUAL);
+
+        if(AT >= 0)
         {
-            MEM_BASE->USAGE.BUS_ERROR++;
-            MEM_ERROR(MEM_ERR_BERR, SIZE, "BERR ACTIVE FOR CURRENT BUFFER: %u", MEM_BASE->BUFFER);
-            goto MALFORMED_WRITE;
+            if(INDEX != NULL) *INDEX = AT;
+            return LANE;
         }
+    }
 
-        // FIRST WE READ AND DETERMINE THE WRITE STATISTICS OF THE CURRENT MEMORY MAP BEING ALLOCATED
-        // THIS CHECK COMES AFTER WHICH WE DETERMINE THE SIZE OF THE MEMORY REGION AS THIS IS TO
-        // AVOID POTENTIAL SPILL-OVERS WITH ADDITIONAL WRITES
+    return 0;
+}
+
+static void VALIDATE_COPY(M68K_VALIDATE_STREAM* DEST, const M68K_VALIDATE_STREAM* SRC)
+{
+    DEST->REGION_COUNT = SRC->REGION_COUNT;
+    DEST->OP_COUNT = SRC->OP_COUNT;
+    memcpy(DEST->REGIONS, SRC->REGIONS, sizeof(SRC->REGIONS));
+    memcpy(DEST->OPS, SRC->OPS, SRC->OP_COUNT * sizeof(M68K_VALIDATE_OP));
+}
 
-        MEM_BASE->USAGE.WRITE_COUNT++;
-        MEM_BASE->USAGE.LAST_WRITE = ADDRESS;
-        MEM_BASE->USAGE.ACCESSED = true;
+// SHRINK A DIVERGING STREAM DOWN TO A MINIMAL REPRODUCER - CHUNKS OF OPERATIONS ARE REMOVED
+// FOR AS LONG AS THE SAME LANE STILL DIVERGES, HALVING THE CHUNK SIZE WHENEVER NONE CAN BE
+// (THE COMPLEMENT HALF OF DELTA DEBUGGING) BEFORE ANY REGION THAT ISN'T NEEDED IS DROPPED
 
-        uint8_t* MEM_PTR = MEM_BASE->BUFFER + OFFSET;
-        MEM_TRACE("[WRITE]", ADDRESS, SIZE, VALUE);
+static void VALIDATE_SHRINK(M68K_VALIDATE_STREAM* STREAM, unsigned LANE)
+{
+    M68K_VALIDATE_STREAM* CANDIDATE = &VALIDATE_CANDIDATE;
+    unsigned GRANULARITY = 2;
 
-        switch (SIZE)
+    while(STREAM->OP_COUNT > 0)
+    {
+        unsigned CHUNK = (STREAM->OP_COUNT + GRANULARITY - 1) / GRANULARITY;
+        bool REDUCED = false;
+
+        for(unsigned START = 0; START < STREAM->OP_COUNT && !REDUCED; START += CHUNK)
         {
-            case MEM_SIZE_32:
-                *MEM_PTR++ = (VALUE >> 24) & M68K_LSB_MASK;
-                *MEM_PTR++ = (VALUE >> 16) & M68K_LSB_MASK;
-                *MEM_PTR++ = (VALUE >> 8) & M68K_LSB_MASK;
-                *MEM_PTR = VALUE & M68K_LSB_MASK;
-                break;
+            unsigned END = (START + CHUNK < STREAM->OP_COUNT) ? START + CHUNK : STREAM->OP_COUNT;
+
+            CANDIDATE->REGION_COUNT = STREAM->REGION_COUNT;
+            CANDIDATE->OP_COUNT = STREAM->OP_COUNT - (END - START);
+            memcpy(CANDIDATE->REGIONS, STREAM->REGIONS, sizeof(STREAM->REGIONS));
+            memcpy(CANDIDATE->OPS, STREAM->OPS, START * sizeof(M68K_VALIDATE_OP));
+            memcpy(CANDIDATE->OPS + START, STREAM->OPS + END, (STREAM->OP_COUNT - END) * sizeof(M68K_VALIDATE_OP));
+
+            if(VALIDATE_DIVERGES(CANDIDATE, 0, NULL, NULL) == LANE)
+            {
+                VALIDATE_COPY(STREAM, CANDIDATE);
+                GRANULARITY = (GRANULARITY > 2) ? GRANULARITY - 1 : 2;
+                REDUCED = true;
+            }
+        }
 
-            case MEM_SIZE_16:
-                *MEM_PTR++ = (VALUE >> 8) & M68K_LSB_MASK;
-                *MEM_PTR = VALUE & M68K_LSB_MASK;
-                break;
-            
-            case MEM_SIZE_8:
-                *MEM_PTR = VALUE & M68K_LSB_MASK;
+        if(!REDUCED)
+        {
+            if(GRANULARITY >= STREAM->OP_COUNT)
                 break;
+
+            GRANULARITY = (GRANULARITY * 2 < STREAM->OP_COUNT) ? GRANULARITY * 2 : STREAM->OP_COUNT;
         }
-        return;
     }
 
-    BUS_ERROR(BERR_UNMAPPED_WRITE, ADDRESS, MEM_WRITE, SIZE);
-    MEM_ERROR(MEM_ERR_UNMAPPED, SIZE, "NO BUFFER FOUND FOR ADDRESS: 0x%0X", ADDRESS);
+    // THE STATIC MAP IS FIXED AT BUILD TIME, SO THERE ARE NO REGIONS TO DROP
+    #if STATIC_MAP_HOOK == M68K_OPT_ON
+    return;
+    #endif
 
-MALFORMED_WRITE:
-    MEM_ERROR(MEM_ERR_BAD_WRITE, SIZE, "VALUE: 0x%0X, ADDRESS: 0x%0X", VALUE, ADDRESS);
-    MEM_TRACE("[INVALID WRITE]", ADDRESS, SIZE, VALUE);
+    for(unsigned INDEX = STREAM->REGION_COUNT; INDEX-- > 0 && STREAM->REGION_COUNT > 1; )
+    {
+        VALIDATE_COPY(CANDIDATE, STREAM);
+        memmove(&CANDIDATE->REGIONS[INDEX], &CANDIDATE->REGIONS[INDEX + 1], 
+                (CANDIDATE->REGION_COUNT - INDEX - 1) * sizeof(M68K_VALIDATE_REGION));
+        CANDIDATE->REGION_COUNT--;
+
+        if(VALIDATE_DIVERGES(CANDIDATE, 0, NULL, NULL) == LANE)
+            VALIDATE_COPY(STREAM, CANDIDATE);
+    }
 }
 
-// MEMORY MOVE OPERATIONS - HANDLES THE SPECIFICS BETWEEN SOURCE
-// AND DESTINATION OPERATIONS
-//
-// LOOKS TO FIND THE SOURCE AND DESTINATION OPERANDS TO PROPERLY
-// VALIDATE THEIR EXECUTION
-static void MEMORY_MOVE(uint32_t SRC, uint32_t DEST, uint32_t SIZE, uint32_t COUNT)
+// SPELL OUT A LANE'S MAP FLAGS AS THEY WOULD BE PASSED TO MEMORY_MAP_EX
+
+static const char* VALIDATE_FLAG_NAMES(uint32_t FLAGS, char* OUT, size_t LENGTH)
 {
-    VERBOSE_TRACE("MOVING %u BYTES FROM 0x%08X TO 0x%08X\n", COUNT, SRC, DEST);
+    static const struct { uint32_t FLAG; const char* NAME; } NAMES[] =
+    {
+        { M68K_MAP_SHARED,      "M68K_MAP_SHARED" },
+        { M68K_MAP_EXPORT,      "M68K_MAP_EXPORT" },
+        { M68K_MAP_THP,         "M68K_MAP_THP" },
+        { M68K_MAP_HUGETLB,     "M68K_MAP_HUGETLB" },
+        { M68K_MAP_POPULATE,    "M68K_MAP_POPULATE" },
+        { M68K_MAP_NUMA_LOCAL,  "M68K_MAP_NUMA_LOCAL" },
+    };
+
+    size_t WRITTEN = 0;
+    snprintf(OUT, LENGTH, "M68K_MAP_NONE");
+
+    for(unsigned INDEX = 0; INDEX < sizeof(NAMES) / sizeof(NAMES[0]); INDEX++)
+    {
+        if(!(FLAGS & NAMES[INDEX].FLAG) || WRITTEN >= LENGTH)
+            continue;
 
-    // FIND BOTH OF THE CURRENT OPERANDS WITHIN THE OPERATION
+        WRITTEN += snprintf(OUT + WRITTEN, LENGTH - WRITTEN, "%s%s", WRITTEN ? " | " : "", NAMES[INDEX].NAME);
+    }
 
-    M68K_MEM_BUFFER* SRC_BUFFER = MEM_FIND(SRC);
-    M68K_MEM_BUFFER* DEST_BUFFER = MEM_FIND(DEST);
+    return OUT;
+}
 
-    if(SRC_BUFFER == NULL)
-    {
-        MEM_ERROR(MEM_ERR_UNMAPPED, SIZE, "NO SOURCE BUFFER FOUND FOR ADDRESS: 0x%08X", SRC);
-        return;
-    }
+// PRINT THE REPRODUCER AS THE CALLS WHICH WOULD RECREATE IT, SO IT CAN BE PASTED STRAIGHT INTO MAIN
+// THE REGIONS ARE MAPPED WITH THE FLAGS OF THE LANE WHICH DIVERGED, AS THAT IS WHERE THE BUG LIVES
 
-    if(DEST_BUFFER == NULL)
+static void VALIDATE_REPORT(const M68K_VALIDATE_STREAM* STREAM, uint64_t SEED)
+{
+    static const char* RMW_NAMES[] = { "MEM_RMW_ADD", "MEM_RMW_SUB", "MEM_RMW_AND", "MEM_RMW_OR", "MEM_RMW_XOR", "MEM_RMW_SWAP" };
+
+    int AT = -1;
+    uint64_t ACTUAL = 0;
+    unsigned LANE = VALIDATE_DIVERGES(STREAM, 0, &AT, &ACTUAL);
+    char FLAGS[128];
+
+    printf("\n[VALIDATE] %s LANE DIVERGES FROM THE REFERENCE (STREAM SEED 0x%016llX)\n", 
+            VALIDATE_LANES[LANE].NAME, (unsigned long long)SEED);
+    printf("[VALIDATE] MINIMAL REPRODUCER (%u OPS, %u REGIONS):\n\n", STREAM->OP_COUNT, STREAM->REGION_COUNT);
+
+    #if STATIC_MAP_HOOK == M68K_OPT_ON
+    printf("    // BUILT WITH -DSTATIC_MAP_HOOK=1 AND M68K_STATIC_MEMORY_MAP(REGION) AS:\n");
+    #endif
+
+    for(unsigned INDEX = 0; INDEX < STREAM->REGION_COUNT; INDEX++)
     {
-        MEM_ERROR(MEM_ERR_UNMAPPED, SIZE, "NO DESTINATION BUFFER FOUND FOR ADDRESS: 0x%08X", DEST);
-        return;
+        const M68K_VALIDATE_REGION* REGION = &STREAM->REGIONS[INDEX];
+
+        #if STATIC_MAP_HOOK == M68K_OPT_ON
+        printf("    //     REGION(%s, 0x%06X, 0x%06X, %s, %s, %s)\n", STATIC_REGION_NAMES[INDEX], REGION->BASE, REGION->END,
+                REGION->WRITE ? "true" : "false", REGION->BERR ? "true" : "false", 
+                VALIDATE_FLAG_NAMES(STATIC_BUFFERS[INDEX].FLAGS, FLAGS, sizeof(FLAGS)));
+        #else
+        printf("    MEMORY_MAP_EX(0x%06X, 0x%06X, %s, %s, %s);\n", REGION->BASE, REGION->END, 
+                REGION->WRITE ? "true" : "false", REGION->BERR ? "true" : "false",
+                VALIDATE_FLAG_NAMES(VALIDATE_LANES[LANE].FLAGS, FLAGS, sizeof(FLAGS)));
+        #endif
     }
 
-    // CAN WE WRITE TO SAID DESTINATION?!
-    // ASSUME THAT WE HAVE THE PROPER CONDITIONS FOR THE HIGH BOUND OF THE EA
-    // THAT OF WHICH ENCOMPASSESS THE WRITE CONDITION
+    if(VALIDATE_LANES[LANE].INCREMENTAL_HASH)
+        printf("    BUS_HASH();\n");
 
-    if(!DEST_BUFFER->WRITE)
+    for(unsigned INDEX = 0; INDEX < STREAM->OP_COUNT; INDEX++)
     {
-        DEST_BUFFER->USAGE.VIOLATION++;
-        MEM_ERROR(MEM_ERR_READONLY, SIZE, "MOVE ATTEMPT TO READ-ONLY MEMORY: 0x%08X, VIOLATION: #%u", DEST, DEST_BUFFER->USAGE.VIOLATION);
-    }
+        const M68K_VALIDATE_OP* OP = &STREAM->OPS[INDEX];
+        uint32_t VALUE = (OP->SIZE == MEM_SIZE_32) ? OP->VALUE : OP->VALUE & ((1U << OP->SIZE) - 1);
 
-    // GET THE ALL ENCOMPASSING SIZE OF THE OPERATION
-    uint32_t TRANSFER_SIZE = SIZE / 8;
+        printf("%s ", ((int)INDEX == AT) ? "  >>" : "    ");
 
-    // DETERMINE THE CONCURRENT BYTES IS REQUIRED PER EACH OPERATION
-    // SIZE IS ALL VARIABLE BASED ON THE DISTANCE BETWEEN INDIRECT AND EA
-    for(uint32_t INDEX = 0; INDEX < COUNT; INDEX += TRANSFER_SIZE)
+        switch (OP->KIND)
+        {
+            case VALIDATE_READ:     printf("M68K_READ_MEMORY_%u(0x%08X);\n", OP->SIZE, OP->ADDRESS); break;
+            case VALIDATE_WRITE:    printf("M68K_WRITE_MEMORY_%u(0x%08X, 0x%X);\n", OP->SIZE, OP->ADDRESS, VALUE); break;
+            case VALIDATE_MOVE:     printf("M68K_MOVE_MEMORY_%u(0x%08X, 0x%08X, %u);\n", OP->SIZE, OP->ADDRESS, OP->DEST, OP->COUNT); break;
+            case VALIDATE_IMM:      printf("M68K_READ_IMM_%u(0x%08X);\n", OP->SIZE, OP->ADDRESS); break;
+            case VALIDATE_TAS:      printf("M68K_TAS_MEMORY_8(0x%08X);\n", OP->ADDRESS); break;
+            case VALIDATE_CAS:      printf("M68K_CAS_MEMORY_%u(0x%08X, &(uint32_t){ 0x%X }, 0x%X);\n", OP->SIZE, OP->ADDRESS, OP->DEST, VALUE); break;
+            case VALIDATE_CAS2:     printf("M68K_CAS2_MEMORY_%u(0x%08X, 0x%08X, &(uint32_t){ 0x%X }, &(uint32_t){ 0x%X }, 0x%X, 0x%X);\n", OP->SIZE, OP->ADDRESS, OP->DEST,
+                                            VALIDATE_CAS2_COMPARE(OP, 1, OP->VALUE), VALIDATE_CAS2_COMPARE(OP, 2, ~OP->VALUE), VALUE, ~OP->VALUE & MEM_RMW_MASK(OP->SIZE)); break;
+            case VALIDATE_FETCH_OP: printf("M68K_FETCH_OP_MEMORY_%u(0x%08X, %s, 0x%X);\n", OP->SIZE, OP->ADDRESS, RMW_NAMES[OP->COUNT], VALUE); break;
+            default:                printf("BERR_ACKNOWLEDGE();\n"); break;
+        }
+    }
+
+    if(AT >= 0)
     {
-        uint32_t CURRENT_SRC = SRC + INDEX;
-        uint32_t CURRENT_DEST = DEST + INDEX;
+        char WHERE[32];
 
-        // READ FROM THE CURRENT SORUCE AGAINST THE SIZE
-        // OF THE OPERATION
-        uint32_t SRC_READ = MEMORY_READ(CURRENT_SRC, SIZE);
+        if(AT == (int)STREAM->OP_COUNT)
+            snprintf(WHERE, sizeof(WHERE), "THE FINAL BUS STATE");
+        else
+            snprintf(WHERE, sizeof(WHERE), "OP #%d", AT);
 
-        // WRITE TO DESTINATION
-        MEMORY_WRITE(CURRENT_DEST, SIZE, SRC_READ);
+        printf("\n[VALIDATE] FIRST DIVERGES AT %s: REFERENCE 0x%016llX, %s 0x%016llX\n", WHERE,
+                (unsigned long long)VALIDATE_EXPECTED[AT], VALIDATE_LANES[LANE].NAME, (unsigned long long)ACTUAL);
     }
 
-    SRC_BUFFER->USAGE.MOVE_COUNT++;
-    SRC_BUFFER->USAGE.LAST_MOVE_SRC = SRC;
-    DEST_BUFFER->USAGE.MOVE_COUNT++;
-    DEST_BUFFER->USAGE.LAST_MOVE_DEST = DEST;
+    fflush(stdout);
+}
 
-    MEM_MOVE_TRACE(SRC, DEST, SIZE, COUNT);
-} 
+#if STATIC_MAP_HOOK == M68K_OPT_OFF
 
-static void MEMORY_MAP(uint32_t BASE, uint32_t END, bool WRITABLE, bool ENABLE_BERR) 
+// THE SHARED LANE ONLY EVER RUNS ON ONE THREAD, SO BEFORE ANY STREAMS THE LOCKED CYCLES ARE HAMMERED
+// FROM TWO AT ONCE - THE 68K SIDE AND A DEVICE THREAD - ON A SHARED REGION. EACH COUNTER IS
+// INCREMENTED THROUGH A DIFFERENT PRIMITIVE, AND NOT ONE INCREMENT MAY BE LOST
+//
+// THE TAS LOCK IS RELEASED WITH A SWAP RATHER THAN A PLAIN WRITE, AS A PLAIN WRITE TO A SHARED
+// REGION IS ONLY RELAXED AND WOULDN'T ORDER THE CRITICAL SECTION BEFORE IT ON EVERY HOST
+//
+// BOTH SIDES ALSO FAULT ON AN UNMAPPED ADDRESS OF THEIR OWN EVERY CYCLE - EACH FAULT MUST BE COUNTED,
+// BUT ONLY THE 68K'S MAY EVER RAISE THE BERR LINE, WHICH IT ACKNOWLEDGES AS IT GOES
+
+#define         VALIDATE_CONTENTION_OPS         100000
+#define         VALIDATE_COUNTER_ADD            0x0100
+#define         VALIDATE_COUNTER_ADD_WORD       0x0202
+#define         VALIDATE_COUNTER_CAS            0x0300
+#define         VALIDATE_COUNTER_LOCK           0x0400
+#define         VALIDATE_COUNTER_LOCKED         0x0404
+#define         VALIDATE_COUNTER_CAS2_LOW       0x0500
+#define         VALIDATE_COUNTER_CAS2_HIGH      0x0602
+#define         VALIDATE_FAULT_CPU              0x2000
+#define         VALIDATE_FAULT_DEVICE           0x3000
+
+static void* VALIDATE_CONTEND(void* ARG)
 {
-    uint32_t SIZE = (END - BASE) + 1;
-    uint32_t MAPPED = SIZE;
+    uint32_t FAULT = (uint32_t)(uintptr_t)ARG;
 
-    if(MEM_NUM_BUFFERS >= M68K_MAX_BUFFERS) 
+    for(unsigned INDEX = 0; INDEX < VALIDATE_CONTENTION_OPS; INDEX++)
     {
-        MEM_ERROR(MEM_ERR_BUFFER, SIZE, "CANNOT MAP - TOO MANY BUFFERS %s", " ");
-        return;
+        M68K_READ_MEMORY_8(FAULT);
+
+        if(FAULT == VALIDATE_FAULT_CPU)
+            BERR_ACKNOWLEDGE();
+
+        M68K_FETCH_OP_MEMORY_32(VALIDATE_COUNTER_ADD, MEM_RMW_ADD, 1);
+        M68K_FETCH_OP_MEMORY_32(VALIDATE_COUNTER_ADD_WORD, MEM_RMW_ADD, 1);
+
+        uint32_t COMPARE = M68K_READ_MEMORY_32(VALIDATE_COUNTER_CAS);
+        while(!M68K_CAS_MEMORY_32(VALIDATE_COUNTER_CAS, &COMPARE, COMPARE + 1));
+
+        uint32_t LOW = M68K_READ_MEMORY_32(VALIDATE_COUNTER_CAS2_LOW);
+        uint32_t HIGH = M68K_READ_MEMORY_32(VALIDATE_COUNTER_CAS2_HIGH);
+        while(!M68K_CAS2_MEMORY_32(VALIDATE_COUNTER_CAS2_LOW, VALIDATE_COUNTER_CAS2_HIGH, &LOW, &HIGH, LOW + 1, HIGH + 1));
+
+        while(M68K_TAS_MEMORY_8(VALIDATE_COUNTER_LOCK) & 0x80);
+        M68K_WRITE_MEMORY_32(VALIDATE_COUNTER_LOCKED, M68K_READ_MEMORY_32(VALIDATE_COUNTER_LOCKED) + 1);
+        M68K_FETCH_OP_MEMORY_8(VALIDATE_COUNTER_LOCK, MEM_RMW_SWAP, 0);
     }
 
-    // DETERMINES WHETHER OR NOT THE MAX SIZE HAS BEEN EXCEEDED 
-    // FOR ONLY A SINGULAR BUFFER
-    if(END > M68K_MAX_ADDR_END)
+    return NULL;
+}
+
+static bool VALIDATE_CONTENTION(void)
+{
+    static const struct { const char* NAME; uint32_t ADDRESS; } COUNTERS[] =
     {
-        MEM_ERROR(MEM_ERR_BUS, (uint32_t)SIZE, "END ADDRESS 0x%08X EXCEEDS THE BUS LIMIT: (0x%08X - %d%s)", 
-                  END, M68K_MAX_ADDR_END, FORMAT_SIZE(M68K_MAX_MEMORY_SIZE), FORMAT_UNIT(M68K_MAX_MEMORY_SIZE));
-        return;
-    }
+        { "FETCH_OP.L",                 VALIDATE_COUNTER_ADD },
+        { "FETCH_OP.L (WORD ALIGNED)",  VALIDATE_COUNTER_ADD_WORD },
+        { "CAS.L",                      VALIDATE_COUNTER_CAS },
+        { "CAS2.L (FIRST OPERAND)",     VALIDATE_COUNTER_CAS2_LOW },
+        { "CAS2.L (SECOND OPERAND)",    VALIDATE_COUNTER_CAS2_HIGH },
+        { "TAS LOCK",                   VALIDATE_COUNTER_LOCKED },
+    };
 
-    // CALCULATE THE TOTAL MAPPED SIZE ACROSS ALL CONCURRENT BUFFERS
-    // THIS PREVENTS POTENTIAL BUFFER OVERFLOWS WHEREBY 
-    // CONJOINED BUFFERS WERE TO EXCEED THE MAX
+    pthread_t DEVICE;
+    bool RESULT = true;
 
-    for(unsigned INDEX = 0; INDEX < MEM_NUM_BUFFERS; INDEX++)
+    MEMORY_UNMAP_ALL();
+    MEMORY_MAP_EX(0x000000, 0x000FFF, true, false, M68K_MAP_SHARED);
+
+    if(pthread_create(&DEVICE, NULL, VALIDATE_CONTEND, (void*)(uintptr_t)VALIDATE_FAULT_DEVICE) != 0)
     {
-        MAPPED += MEM_BUFFERS[INDEX].SIZE;
+        printf("[VALIDATE] COULD NOT START THE DEVICE THREAD\n");
+        MEMORY_UNMAP_ALL();
+        return false;
     }
 
-    if(MAPPED > M68K_MAX_MEMORY_SIZE)
+    VALIDATE_CONTEND((void*)(uintptr_t)VALIDATE_FAULT_CPU);
+    pthread_join(DEVICE, NULL);
+
+    uint32_t FAULTS = __atomic_load_n(&BERR_QUEUE.TYPE_COUNT[BERR_UNMAPPED_READ], __ATOMIC_RELAXED);
+
+    if(FAULTS != 2 * VALIDATE_CONTENTION_OPS || BERR_STATE.FAULT_COUNT != VALIDATE_CONTENTION_OPS ||
+       BERR_STATE.CURRENT_ADDRESS != VALIDATE_FAULT_CPU || M68K_STOPPED)
     {
-        MEM_ERROR(MEM_ERR_BOUNDS, SIZE, "TOTAL MAPPED SIZE: (%d%s) EXCEEDS THE BUS LIMIT", 
-            FORMAT_SIZE(MAPPED), FORMAT_UNIT(MAPPED));
-            return;
+        printf("[VALIDATE] FAULTS FROM BOTH SIDES: %u OF %u COUNTED, %u OF %u LATCHED, LAST AT 0x%08X%s\n", 
+                FAULTS, 2 * VALIDATE_CONTENTION_OPS, BERR_STATE.FAULT_COUNT, VALIDATE_CONTENTION_OPS, 
+                BERR_STATE.CURRENT_ADDRESS, M68K_STOPPED ? ", DOUBLE FAULTED" : "");
+        RESULT = false;
     }
 
-    // DEFINE AND INITIALISE BUFFER-RELATED PARAMS
-    // ONLY ALLOCATE HOW MANY BUFFERS WE NEED BASED ON THE MAX
-    M68K_MEM_BUFFER* BUF = &MEM_BUFFERS[MEM_NUM_BUFFERS++];
-    BUF->BASE = BASE;
-    BUF->END = END;
-    BUF->SIZE = SIZE;
-    BUF->WRITE = WRITABLE;
-    BUF->BERR = ENABLE_BERR;
-    BUF->BUFFER = malloc(SIZE);
-    memset(BUF->BUFFER, 0, SIZE);
+    for(unsigned INDEX = 0; INDEX < sizeof(COUNTERS) / sizeof(COUNTERS[0]); INDEX++)
+    {
+        uint32_t VALUE = M68K_READ_MEMORY_32(COUNTERS[INDEX].ADDRESS);
 
-    // DETERMINE WHICH MEMORY MAPS ARE BEING USED AT ANY GIVEN TIME
-    // FOR NOW, WE ARE ONLY CONCERNED WITH THE RAM AND IO TO COMMUNICATE
-    // WITH THE 68K'S BUS
+        if(VALUE != 2 * VALIDATE_CONTENTION_OPS)
+        {
+            printf("[VALIDATE] %s SAW %u OF %u INCREMENTS UNDER CONTENTION\n", COUNTERS[INDEX].NAME, 
+                    VALUE, 2 * VALIDATE_CONTENTION_OPS);
+            RESULT = false;
+        }
+    }
 
-    memset(&BUF->USAGE, 0, sizeof(M68K_MEM_USAGE));
-    BUF->USAGE.ACCESSED = false;
+    printf("[VALIDATE] 2 THREADS x %u LOCKED CYCLES OF EACH KIND AND FAULTS ON A SHARED REGION: %s\n", 
+            VALIDATE_CONTENTION_OPS, RESULT ? "OK" : "FAILED");
 
-    MEM_MAP_TRACE(MEM_MAP, BUF->BASE, BUF->END, BUF->SIZE, BUF->BUFFER);
+    MEMORY_UNMAP_ALL();
+    return RESULT;
 }
 
-////////////////////////////////////////////////////////////////////////////////////////
-//              EACH OF THESE WILL REPRESENT AN UNSIGNED INT VALUE   
-//                FROM THERE, BEING SIGNED A SIZE DEFINER
-//                  IN ACCORDANCE WITH AN ENUM VALUE
-////////////////////////////////////////////////////////////////////////////////////////
+#endif
 
-unsigned int M68K_READ_MEMORY_8(unsigned int ADDRESS)  { return MEMORY_READ(ADDRESS, MEM_SIZE_8); }
-unsigned int M68K_READ_MEMORY_16(unsigned int ADDRESS) { return MEMORY_READ(ADDRESS, MEM_SIZE_16); }
-unsigned int M68K_READ_MEMORY_32(unsigned int ADDRESS) { return MEMORY_READ(ADDRESS, MEM_SIZE_32); }
+static void VALIDATE_WORKER(unsigned WORKER, uint64_t SEED, double SECONDS, int PIPE)
+{
+    M68K_VALIDATE_RESULT RESULT = {0};
+    uint64_t STATE = SEED + (WORKER * 0xD1B54A32D192ED03ULL);
+    double START = VALIDATE_NOW();
 
-void M68K_WRITE_MEMORY_8(unsigned int ADDRESS, uint8_t VALUE)   { MEMORY_WRITE(ADDRESS, MEM_SIZE_8, VALUE); }
-void M68K_WRITE_MEMORY_16(unsigned int ADDRESS, uint16_t VALUE) { MEMORY_WRITE(ADDRESS, MEM_SIZE_16, VALUE); }
-void M68K_WRITE_MEMORY_32(unsigned int ADDRESS, uint32_t VALUE) { MEMORY_WRITE(ADDRESS, MEM_SIZE_32, VALUE); }
+    do
+    {
+        for(unsigned BATCH = 0; BATCH < VALIDATE_BATCH; BATCH++)
+        {
+            uint64_t STREAM_SEED = VALIDATE_RANDOM(&STATE);
+
+            VALIDATE_GENERATE(&VALIDATE_STREAM, STREAM_SEED);
+            unsigned LANE = VALIDATE_DIVERGES(&VALIDATE_STREAM, RESULT.STREAMS, NULL, NULL);
+
+            for(unsigned RAN = 0; RAN < VALIDATE_NUM_LANES; RAN++)
+            {
+                if(VALIDATE_SAMPLED(RAN, RESULT.STREAMS))
+                    RESULT.OPS += VALIDATE_STREAM.OP_COUNT;
+            }
+
+            RESULT.STREAMS++;
+
+            if(LANE != 0)
+            {
+                RESULT.MISMATCHES++;
+                VALIDATE_SHRINK(&VALIDATE_STREAM, LANE);
+                VALIDATE_REPORT(&VALIDATE_STREAM, STREAM_SEED);
+                goto WORKER_DONE;
+            }
+        }
 
-void M68K_MOVE_MEMORY_8(unsigned SRC, unsigned DEST, unsigned COUNT)    { MEMORY_MOVE(SRC, DEST, MEM_SIZE_8, COUNT); }
-void M68K_MOVE_MEMORY_16(unsigned SRC, unsigned DEST, unsigned COUNT)   { MEMORY_MOVE(SRC, DEST, MEM_SIZE_16, COUNT); }
-void M68K_MOVE_MEMORY_32(unsigned SRC, unsigned DEST, unsigned COUNT)   { MEMORY_MOVE(SRC, DEST, MEM_SIZE_32, COUNT); }
+    } while(VALIDATE_NOW() - START < SECONDS);
 
-// OF COURSE THESE ARE CHANGED IN LIB68K TO HAVE NO LOCAL ARGS
-// AS THE IMMEDIATE READ IS GOVERNED BY THE EA LOADED INTO MEMORY
+WORKER_DONE:
+    MEMORY_UNMAP_ALL();
 
-unsigned int M68K_READ_IMM_16(unsigned int ADDRESS)
+    if(write(PIPE, &RESULT, sizeof(RESULT)) != sizeof(RESULT))
+        _exit(1);
+}
+
+// ./mem --validate [SECONDS] [WORKERS] [SEED]
+// WORKERS DEFAULTS TO ONE PER ONLINE CORE, THE SEED TO THE CURRENT TIME
+
+static int VALIDATE_MAIN(int argc, char** argv)
 {
-    bool TRACE = TRACE_ENABLED;
-    TRACE_ENABLED = false;
+    double SECONDS = (argc > 0) ? atof(argv[0]) : 10.0;
+    long WORKERS = (argc > 1) ? atol(argv[1]) : sysconf(_SC_NPROCESSORS_ONLN);
+    uint64_t SEED = (argc > 2) ? strtoull(argv[2], NULL, 0) : (uint64_t)time(NULL);
 
-    unsigned int RESULT = M68K_READ_MEMORY_16(ADDRESS);
-    TRACE_ENABLED = TRACE;
+    M68K_VALIDATE_RESULT TOTAL = {0};
+    M68K_VALIDATE_RESULT RESULT;
+    long FINISHED = 0;
+    int PIPE[2];
 
-    return RESULT;
-}
+    if(WORKERS < 1)
+        WORKERS = 1;
 
-unsigned int M68K_READ_IMM_32(unsigned int ADDRESS)
-{
-    bool TRACE = TRACE_ENABLED;
-    TRACE_ENABLED = false;
+    // TRACING WOULD DWARF THE BUS ITSELF
+    SET_TRACE_FLAGS(0, 0);
 
-    unsigned int RESULT = M68K_READ_MEMORY_32(ADDRESS);
-    TRACE_ENABLED = TRACE;
+    if(pipe(PIPE) != 0)
+    {
+        printf("[VALIDATE] COULD NOT CREATE THE RESULT PIPE\n");
+        return 1;
+    }
 
-    return RESULT;
+    printf("[VALIDATE] %ld WORKERS, %u LANES, %u OPS PER STREAM, %.1f SECONDS, SEED 0x%016llX\n",
+            WORKERS, (unsigned)VALIDATE_NUM_LANES, M68K_VALIDATE_OPS, SECONDS, (unsigned long long)SEED);
+    fflush(stdout);
+
+    // THE CONTENTION CHECK MAPS IT'S OWN SHARED REGION, WHICH THE STATIC DECODER WOULD NEVER SEE
+    #if STATIC_MAP_HOOK == M68K_OPT_OFF
+    if(!VALIDATE_CONTENTION())
+        return 1;
+    #endif
+
+    fflush(stdout);
+
+    double START = VALIDATE_NOW();
+
+    for(long WORKER = 0; WORKER < WORKERS; WORKER++)
+    {
+        pid_t PID = fork();
+
+        if(PID == 0)
+        {
+            close(PIPE[0]);
+            VALIDATE_WORKER((unsigned)WORKER, SEED, SECONDS, PIPE[1]);
+            _exit(0);
+        }
+
+        if(PID < 0)
+        {
+            WORKERS = WORKER;
+            break;
+        }
+    }
+
+    close(PIPE[1]);
+
+    // EACH RESULT IS FAR SMALLER THAN PIPE_BUF, SO IT ALWAYS ARRIVES IN ONE PIECE
+
+    while(read(PIPE[0], &RESULT, sizeof(RESULT)) == sizeof(RESULT))
+    {
+        TOTAL.OPS += RESULT.OPS;
+        TOTAL.STREAMS += RESULT.STREAMS;
+        TOTAL.MISMATCHES += RESULT.MISMATCHES;
+        FINISHED++;
+    }
+
+    close(PIPE[0]);
+    while(wait(NULL) > 0);
+
+    double ELAPSED = VALIDATE_NOW() - START;
+
+    printf("\n[VALIDATE] %llu OPS OVER %llu STREAMS IN %.2fs (%.1fM OPS/MIN), %llu MISMATCHES\n",
+            (unsigned long long)TOTAL.OPS, (unsigned long long)TOTAL.STREAMS, ELAPSED,
+            (TOTAL.OPS / ELAPSED) * 60.0 / 1e6, (unsigned long long)TOTAL.MISMATCHES);
+
+    if(FINISHED != WORKERS)
+        printf("[VALIDATE] %ld OF %ld WORKERS DID NOT FINISH\n", WORKERS - FINISHED, WORKERS);
+
+    return (TOTAL.MISMATCHES || FINISHED != WORKERS) ? 1 : 0;
 }
 
-int main(void) 
+#endif
+
+int main(int argc, char** argv) 
 {
     printf("======================================\n");
     printf("HARRY CLARK - LIB68K MEMORY VALIDATOR\n");
     printf("======================================\n");
 
+    #if VALIDATE_HOOK == M68K_OPT_ON
+    if(argc > 1 && strcmp(argv[1], "--validate") == 0)
+        return VALIDATE_MAIN(argc - 2, argv + 2);
+    #endif
+
     ENABLED_FLAGS = M68K_OPT_FLAGS;
     SET_TRACE_FLAGS(1,0);
     SHOW_TRACE_STATUS();
 
-    MEMORY_MAP(0x000000, 0xFFFFFF, true, true);
+    // THE HANDFUL OF ACCESSES BELOW ARE ALL WORTH SAMPLING
+    #if LATENCY_HOOK == M68K_OPT_ON
+    MEMORY_LATENCY_SAMPLING(1);
+    #endif
+
+    #if STATIC_MAP_HOOK == M68K_OPT_ON
+    printf("STATIC MAP CROSS-CHECK: %s\n", STATIC_MAP_CROSS_CHECK() ? "OK" : "FAILED");
+    #else
+    MEMORY_MAP_EX(0x000000, 0xFFFFFF, true, true, M68K_MAP_DEFAULT_FLAGS);
+    #endif
 
     #if FORCE_UNSAFE_REGIONS == M68K_OPT_ON
     MEMORY_MAP(0x000000, 0xFFFFFF, true, true);
@@ -812,6 +3940,32 @@ int main(void)
     uint32_t IMM_32 = 0xFFFFFFFF;
     M68K_WRITE_MEMORY_32(0x1030, IMM_32);
 
+    printf("TESTING ATOMIC BUS OPERATIONS\n");
+
+    uint8_t TAS_FIRST = M68K_TAS_MEMORY_8(0x1040);
+    uint8_t TAS_SECOND = M68K_TAS_MEMORY_8(0x1040);
+
+    uint32_t CAS_COMPARE = 0xBBCC;
+    bool CAS_RESULT = M68K_CAS_MEMORY_16(0x1010, &CAS_COMPARE, 0x1234);
+
+    uint32_t FETCH_ADD = M68K_FETCH_OP_MEMORY_32(0x1020, MEM_RMW_ADD, 1);
+
+    // ONLY WORD ALIGNED, SO THIS ONE TAKES THE SERIALISED PATH
+    uint32_t CAS_LONG_COMPARE = 0xFFFF0000;
+    bool CAS_LONG = M68K_CAS_MEMORY_32(0x1032, &CAS_LONG_COMPARE, 0x12345678);
+
+    // THE FIRST CAS2 MATCHES BOTH OPERANDS, THE SECOND (STILL HOLDING THE OLD COMPARES) FAILS AND LOADS BOTH
+    uint32_t CAS2_FIRST = 0x1234;
+    uint32_t CAS2_SECOND = 0x0000;
+    bool CAS2_RESULT = M68K_CAS2_MEMORY_16(0x1010, 0x1050, &CAS2_FIRST, &CAS2_SECOND, 0xAAAA, 0x5555);
+    bool CAS2_FAILED = !M68K_CAS2_MEMORY_16(0x1010, 0x1050, &CAS2_FIRST, &CAS2_SECOND, 0x0000, 0x0000);
+
+    bool ATOMIC_OK = TAS_FIRST == 0x00 && TAS_SECOND == 0x80 && CAS_RESULT && CAS_LONG &&
+                     CAS2_RESULT && CAS2_FAILED && CAS2_FIRST == 0xAAAA && CAS2_SECOND == 0x5555 &&
+                     FETCH_ADD == TEST_32 && M68K_READ_MEMORY_32(0x1020) == TEST_32 + 1;
+
+    printf("ATOMIC BUS OPERATIONS: %s\n", ATOMIC_OK ? "OK" : "FAILED");
+
     printf("TESTING BERR SOFTWARE COROUTINES\n");
 
     uint16_t UNMAPPED_READ = M68K_READ_MEMORY_16(0x200000);
@@ -821,6 +3975,23 @@ int main(void)
 
     M68K_STOPPED = 1;
     SHOW_MEMORY_MAPS();
+    SHOW_BERR_EVENTS();
 
-    return 0;
+    printf("\nBUS HASH: 0x%016llX\n", (unsigned long long)BUS_HASH());
+
+    #if LATENCY_HOOK == M68K_OPT_ON
+    if(MEMORY_LATENCY_JSON(M68K_LATENCY_JSON))
+        printf("LATENCY HISTOGRAMS WRITTEN TO: %s\n", M68K_LATENCY_JSON);
+    #endif
+
+    // THE EXPORT IS UNLINKED WHEN CLOSED, SO --hold KEEPS IT AROUND FOR A READER TO INSPECT
+    if(MEM_EXPORT != NULL && argc > 1 && strcmp(argv[1], "--hold") == 0)
+    {
+        printf("EXPORT HELD UNDER %s - PRESS ENTER TO RELEASE\n", M68K_EXPORT_NAME);
+        getchar();
+    }
+
+    MEMORY_EXPORT_CLOSE();
+
+    return ATOMIC_OK ? 0 : 1;
 }
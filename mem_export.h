@@ -0,0 +1,71 @@
+// COPYRIGHT (C) HARRY CLARK 2025
+// SMALL LIB68K MEMORY UTILITY/VALIDATOR
+
+// THIS FILE DESCRIBES THE LAYOUT OF THE SHARED MEMORY OBJECT WHICH GUEST RAM IS EXPORTED THROUGH
+// THE VALIDATOR WRITES IT, WHEREAS ANY LOCAL PROCESS (DEBUGGER, VISUALISER, MEM_READER) MAY MAP IT READ-ONLY
+
+// THE OBJECT IS A SINGLE HEADER, FOLLOWED BY THE BACKING STORAGE OF EACH EXPORTED REGION
+// AT A PAGE ALIGNED OFFSET - THE USAGE COUNTERS OF EACH REGION LIVE WITHIN THE HEADER ITSELF
+// SO THAT A READER ALWAYS SEES THEM LIVE
+
+#ifndef LIB68K_MEM_EXPORT_H
+#define LIB68K_MEM_EXPORT_H
+
+// NESTED INCLUDES
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#define     M68K_EXPORT_MAGIC               0x4D36384B
+#define     M68K_EXPORT_VERSION             1
+#define     M68K_EXPORT_MAX_REGIONS         8
+#define     M68K_EXPORT_PAGE_SIZE           4096
+
+#ifndef     M68K_EXPORT_NAME
+    #define M68K_EXPORT_NAME                "/lib68k_mem"
+#endif
+
+#define     M68K_EXPORT_RW                  (1 << 0)
+#define     M68K_EXPORT_BERR                (1 << 1)
+
+typedef struct
+{
+    uint32_t READ_COUNT;
+    uint32_t WRITE_COUNT;
+    uint32_t MOVE_COUNT;
+    uint32_t LAST_READ;
+    uint32_t LAST_WRITE;
+    uint32_t LAST_MOVE_SRC;
+    uint32_t LAST_MOVE_DEST;
+    uint32_t VIOLATION;
+    uint32_t BUS_ERROR;
+    bool ACCESSED;
+
+} M68K_MEM_USAGE;
+
+typedef struct
+{
+    uint32_t BASE;
+    uint32_t END;
+    uint32_t SIZE;
+    uint32_t FLAGS;
+    uint64_t DATA_OFFSET;
+    M68K_MEM_USAGE USAGE;
+
+} M68K_EXPORT_REGION;
+
+// REGION_COUNT IS ONLY EVER INCREMENTED ONCE A REGION HAS BEEN FULLY DESCRIBED
+// SO A READER CAN SAFELY WALK EVERY ENTRY BELOW IT
+
+typedef struct
+{
+    uint32_t MAGIC;
+    uint32_t VERSION;
+    uint32_t REGION_COUNT;
+    uint32_t HEADER_SIZE;
+    uint64_t TOTAL_SIZE;
+    M68K_EXPORT_REGION REGIONS[M68K_EXPORT_MAX_REGIONS];
+
+} M68K_EXPORT_HEADER;
+
+#endif
@@ -0,0 +1,184 @@
+// COPYRIGHT (C) HARRY CLARK 2025
+// SMALL LIB68K MEMORY UTILITY/VALIDATOR
+
+// A SMALL SAMPLE READER FOR THE SHARED MEMORY EXPORT OF THE VALIDATOR
+// MAPS THE OBJECT READ-ONLY, PRINTS THE REGION TABLE WITH IT'S LIVE USAGE COUNTERS
+// AND OPTIONALLY DUMPS A RANGE OF GUEST MEMORY - NO COPIES, NO ROUND TRIPS TO THE EMULATOR
+
+// USAGE: ./mem_reader [ADDRESS] [LENGTH] [NAME]
+
+// NESTED INCLUDES
+
+#ifndef _GNU_SOURCE
+    #define _GNU_SOURCE
+#endif
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdlib.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#include "mem_export.h"
+
+#define         READER_DEFAULT_LENGTH           0x100
+#define         READER_BYTES_PER_LINE           16
+
+#define         KB_TO_BYTES                     1024
+#define         MB_TO_BYTES                     (1024 * 1024)
+
+#define         FORMAT_SIZE(SIZE) \
+                (SIZE) >= MB_TO_BYTES ? (SIZE)/MB_TO_BYTES : \
+                (SIZE) >= KB_TO_BYTES ? (SIZE)/KB_TO_BYTES : (SIZE)
+
+#define         FORMAT_UNIT(SIZE) \
+                (SIZE) >= MB_TO_BYTES ? "MB" : \
+                (SIZE) >= KB_TO_BYTES ? "KB" : "B"
+
+static void SHOW_EXPORTED_MAPS(const M68K_EXPORT_HEADER* HEADER, uint32_t COUNT)
+{
+    printf("\nEXPORTED MEMORY MAPS:\n");
+    printf("------------------------------------------------------------------------------------------------------\n");
+    printf("START        END         SIZE    BERR  STATE   READS   WRITES  MOVES   ACCESS  VIOLATIONS   BUS_ERRORS\n");
+    printf("------------------------------------------------------------------------------------------------------\n");
+
+    for(uint32_t INDEX = 0; INDEX < COUNT; INDEX++)
+    {
+        const M68K_EXPORT_REGION* REGION = &HEADER->REGIONS[INDEX];
+
+        printf("0x%08X 0x%08X   %4d%s   %3s   %2s  %7u  %7u %6u      %3s     %4u        %6u\n",
+            REGION->BASE,
+            REGION->END,
+            FORMAT_SIZE(REGION->SIZE),
+            FORMAT_UNIT(REGION->SIZE),
+            (REGION->FLAGS & M68K_EXPORT_BERR) ? "ON" : "OFF",
+            (REGION->FLAGS & M68K_EXPORT_RW) ? "RW" : "RO",
+            REGION->USAGE.READ_COUNT,
+            REGION->USAGE.WRITE_COUNT,
+            REGION->USAGE.MOVE_COUNT,
+            REGION->USAGE.ACCESSED ? "YES" : "NO",
+            REGION->USAGE.VIOLATION,
+            REGION->USAGE.BUS_ERROR);
+    }
+
+    printf("------------------------------------------------------------------------------------------------------\n");
+}
+
+// THE EXPORT IS WRITTEN BY ANOTHER PROCESS, SO NOTHING WITHIN IT IS TRUSTED - A REGION'S
+// DATA MUST SIT PAST THE HEADER AND END WITHIN THE OBJECT BEFORE ANY OF IT IS TOUCHED
+
+static bool EXPORT_REGION_VALID(const M68K_EXPORT_HEADER* HEADER, const M68K_EXPORT_REGION* REGION, uint64_t MAPPED)
+{
+    if(REGION->END < REGION->BASE || REGION->SIZE != (REGION->END - REGION->BASE) + 1)
+        return false;
+
+    if(REGION->DATA_OFFSET < HEADER->HEADER_SIZE || REGION->DATA_OFFSET > MAPPED)
+        return false;
+
+    return REGION->SIZE <= MAPPED - REGION->DATA_OFFSET;
+}
+
+// DUMP GUEST MEMORY STRAIGHT OUT OF THE MAPPING, CLAMPED TO THE REGION IT FALLS WITHIN
+
+static bool DUMP_EXPORTED_MEMORY(const M68K_EXPORT_HEADER* HEADER, uint32_t COUNT, uint64_t MAPPED, uint32_t ADDRESS, uint32_t LENGTH)
+{
+    for(uint32_t INDEX = 0; INDEX < COUNT; INDEX++)
+    {
+        const M68K_EXPORT_REGION* REGION = &HEADER->REGIONS[INDEX];
+
+        if(ADDRESS < REGION->BASE || ADDRESS > REGION->END)
+            continue;
+
+        if(!EXPORT_REGION_VALID(HEADER, REGION, MAPPED))
+        {
+            printf("[ERROR] -> REGION 0x%08X - 0x%08X LIES OUTSIDE OF THE EXPORT\n", REGION->BASE, REGION->END);
+            return false;
+        }
+
+        const uint8_t* DATA = (const uint8_t*)HEADER + REGION->DATA_OFFSET;
+        uint32_t OFFSET = ADDRESS - REGION->BASE;
+
+        if(LENGTH > REGION->SIZE - OFFSET)
+            LENGTH = REGION->SIZE - OFFSET;
+
+        for(uint32_t BYTE = 0; BYTE < LENGTH; BYTE++)
+        {
+            if(BYTE % READER_BYTES_PER_LINE == 0)
+                printf("%s0x%08X: ", BYTE ? "\n" : "", ADDRESS + BYTE);
+
+            printf("%02X ", DATA[OFFSET + BYTE]);
+        }
+
+        printf("\n");
+        return true;
+    }
+
+    printf("[ERROR] -> ADDRESS 0x%08X IS NOT WITHIN ANY EXPORTED REGION\n", ADDRESS);
+    return false;
+}
+
+int main(int argc, char** argv)
+{
+    const char* NAME = (argc > 3) ? argv[3] : M68K_EXPORT_NAME;
+
+    int FD = shm_open(NAME, O_RDONLY, 0);
+
+    if(FD < 0)
+    {
+        printf("[ERROR] -> NO EXPORT FOUND UNDER %s - IS THE VALIDATOR RUNNING WITH M68K_MAP_EXPORT?\n", NAME);
+        return 1;
+    }
+
+    struct stat INFO;
+
+    if(fstat(FD, &INFO) != 0 || (size_t)INFO.st_size < sizeof(M68K_EXPORT_HEADER))
+    {
+        printf("[ERROR] -> %s IS TOO SMALL TO BE AN EXPORT\n", NAME);
+        close(FD);
+        return 1;
+    }
+
+    const M68K_EXPORT_HEADER* HEADER = mmap(NULL, (size_t)INFO.st_size, PROT_READ, MAP_SHARED, FD, 0);
+    close(FD);
+
+    if(HEADER == MAP_FAILED)
+    {
+        printf("[ERROR] -> COULD NOT MAP %s\n", NAME);
+        return 1;
+    }
+
+    if(__atomic_load_n(&HEADER->MAGIC, __ATOMIC_ACQUIRE) != M68K_EXPORT_MAGIC || HEADER->VERSION != M68K_EXPORT_VERSION)
+    {
+        printf("[ERROR] -> %s IS NOT A VERSION %d EXPORT\n", NAME, M68K_EXPORT_VERSION);
+        return 1;
+    }
+
+    uint64_t MAPPED = (uint64_t)INFO.st_size;
+
+    if(HEADER->HEADER_SIZE < sizeof(M68K_EXPORT_HEADER) || HEADER->HEADER_SIZE > MAPPED)
+    {
+        printf("[ERROR] -> %s HAS A MALFORMED HEADER\n", NAME);
+        return 1;
+    }
+
+    uint32_t COUNT = __atomic_load_n(&HEADER->REGION_COUNT, __ATOMIC_ACQUIRE);
+
+    if(COUNT > M68K_EXPORT_MAX_REGIONS)
+        COUNT = M68K_EXPORT_MAX_REGIONS;
+
+    SHOW_EXPORTED_MAPS(HEADER, COUNT);
+
+    if(argc > 1)
+    {
+        uint32_t ADDRESS = (uint32_t)strtoul(argv[1], NULL, 0);
+        uint32_t LENGTH = (argc > 2) ? (uint32_t)strtoul(argv[2], NULL, 0) : READER_DEFAULT_LENGTH;
+
+        if(!DUMP_EXPORTED_MEMORY(HEADER, COUNT, MAPPED, ADDRESS, LENGTH))
+            return 1;
+    }
+
+    return 0;
+}